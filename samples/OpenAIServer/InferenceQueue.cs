@@ -0,0 +1,71 @@
+using Fluid.OpenVINO.GenAI;
+
+namespace OpenAIServer;
+
+/// <summary>
+/// Limits concurrency to the replicas of a pipeline pool and bounds the number of waiting requests
+/// </summary>
+public sealed class InferenceQueue<TPipeline> : IDisposable where TPipeline : class, IDisposable
+{
+    private readonly PipelinePool<TPipeline> _pool;
+    private readonly int _maxQueueLength;
+    private int _queued;
+
+    /// <summary>
+    /// Initializes a new instance of the InferenceQueue class
+    /// </summary>
+    /// <param name="pool">The pool whose replicas serve requests; owned by the queue</param>
+    /// <param name="modelName">Model name reported in responses</param>
+    /// <param name="maxQueueLength">Maximum number of requests waiting for a replica</param>
+    public InferenceQueue(PipelinePool<TPipeline> pool, string modelName, int maxQueueLength)
+    {
+        if (maxQueueLength < 0)
+            throw new ArgumentOutOfRangeException(nameof(maxQueueLength), "Queue length cannot be negative");
+
+        _pool = pool ?? throw new ArgumentNullException(nameof(pool));
+        ModelName = modelName;
+        _maxQueueLength = maxQueueLength;
+    }
+
+    /// <summary>
+    /// Gets the model name reported in responses
+    /// </summary>
+    public string ModelName { get; }
+
+    /// <summary>
+    /// Gets the number of requests waiting for a replica
+    /// </summary>
+    public int Queued => Volatile.Read(ref _queued);
+
+    /// <summary>
+    /// Waits for a replica
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token, typically the request's abort token</param>
+    /// <returns>The lease, or null if the queue is full</returns>
+    public async ValueTask<PipelineLease<TPipeline>?> EnterAsync(CancellationToken cancellationToken)
+    {
+        // Skipping ahead of waiting requests would starve them
+        if (Volatile.Read(ref _queued) == 0 && _pool.TryRent(out var lease))
+            return lease;
+
+        if (Interlocked.Increment(ref _queued) > _maxQueueLength)
+        {
+            Interlocked.Decrement(ref _queued);
+            return null;
+        }
+
+        try
+        {
+            return await _pool.RentAsync(cancellationToken);
+        }
+        finally
+        {
+            Interlocked.Decrement(ref _queued);
+        }
+    }
+
+    /// <summary>
+    /// Releases the pool and its pipelines
+    /// </summary>
+    public void Dispose() => _pool.Dispose();
+}
@@ -0,0 +1,76 @@
+using System.Text.Json;
+
+namespace OpenAIServer;
+
+// Request and response bodies of the OpenAI API subset served here. Property names are
+// mapped to snake_case by the serializer options in Program.cs.
+
+public sealed class ChatMessage
+{
+    public string Role { get; set; } = "user";
+
+    public string? Content { get; set; }
+}
+
+public sealed class ChatCompletionRequest
+{
+    public string? Model { get; set; }
+
+    public List<ChatMessage> Messages { get; set; } = new();
+
+    public int? MaxTokens { get; set; }
+
+    public float? Temperature { get; set; }
+
+    public float? TopP { get; set; }
+
+    /// <summary>
+    /// A string or an array of strings
+    /// </summary>
+    public JsonElement? Stop { get; set; }
+
+    public bool Stream { get; set; }
+}
+
+public sealed class CompletionRequest
+{
+    public string? Model { get; set; }
+
+    public string Prompt { get; set; } = "";
+
+    public int? MaxTokens { get; set; }
+
+    public float? Temperature { get; set; }
+
+    public float? TopP { get; set; }
+
+    /// <summary>
+    /// A string or an array of strings
+    /// </summary>
+    public JsonElement? Stop { get; set; }
+
+    public bool Stream { get; set; }
+}
+
+public sealed record Usage(int PromptTokens, int CompletionTokens, int TotalTokens);
+
+public sealed record ChatChoice(int Index, ChatMessage Message, string FinishReason);
+
+public sealed record ChatCompletionResponse(
+    string Id, string Object, long Created, string Model, IReadOnlyList<ChatChoice> Choices, Usage Usage);
+
+public sealed record CompletionChoice(int Index, string Text, string FinishReason);
+
+public sealed record CompletionResponse(
+    string Id, string Object, long Created, string Model, IReadOnlyList<CompletionChoice> Choices, Usage Usage);
+
+public sealed record TranscriptionSegment(int Id, float Start, float End, string Text);
+
+public sealed record TranscriptionResponse(string Text);
+
+public sealed record VerboseTranscriptionResponse(
+    string Task, string? Language, float Duration, string Text, IReadOnlyList<TranscriptionSegment> Segments);
+
+public sealed record ErrorDetail(string Message, string Type, string? Code);
+
+public sealed record ErrorResponse(ErrorDetail Error);
@@ -0,0 +1,389 @@
+using System.Text;
+using System.Text.Json;
+using Fluid.OpenVINO.GenAI;
+
+namespace OpenAIServer;
+
+/// <summary>
+/// Handlers for the OpenAI-compatible endpoints
+/// </summary>
+public static class OpenAIEndpoints
+{
+    private const int SampleRate = 16000;
+
+    /// <summary>
+    /// Maps the /v1 endpoints
+    /// </summary>
+    public static IEndpointRouteBuilder MapOpenAIEndpoints(this IEndpointRouteBuilder app)
+    {
+        app.MapGet("/v1/models", ListModelsAsync);
+        app.MapPost("/v1/chat/completions", ChatCompletionsAsync);
+        app.MapPost("/v1/completions", CompletionsAsync);
+        app.MapPost("/v1/embeddings", EmbeddingsAsync);
+        app.MapPost("/v1/audio/transcriptions", TranscriptionsAsync);
+        return app;
+    }
+
+    private static Task ListModelsAsync(HttpContext context)
+    {
+        var models = new List<object>();
+        if (context.RequestServices.GetService<InferenceQueue<LLMPipeline>>() is { } llm)
+            models.Add(new { Id = llm.ModelName, Object = "model", OwnedBy = "openvino" });
+        if (context.RequestServices.GetService<InferenceQueue<WhisperPipeline>>() is { } whisper)
+            models.Add(new { Id = whisper.ModelName, Object = "model", OwnedBy = "openvino" });
+
+        return context.Response.WriteAsJsonAsync(new { Object = "list", Data = models }, context.RequestAborted);
+    }
+
+    private static Task ChatCompletionsAsync(HttpContext context, ChatCompletionRequest request)
+    {
+        if (request.Messages.Count == 0)
+            return WriteErrorAsync(context, StatusCodes.Status400BadRequest, "'messages' must contain at least one message", "invalid_request_error");
+
+        return CompleteAsync(context, BuildChatPrompt(request.Messages), request.MaxTokens, request.Temperature,
+            request.TopP, request.Stop, request.Stream, chat: true);
+    }
+
+    private static Task CompletionsAsync(HttpContext context, CompletionRequest request)
+    {
+        if (string.IsNullOrEmpty(request.Prompt))
+            return WriteErrorAsync(context, StatusCodes.Status400BadRequest, "'prompt' cannot be empty", "invalid_request_error");
+
+        return CompleteAsync(context, request.Prompt, request.MaxTokens, request.Temperature,
+            request.TopP, request.Stop, request.Stream, chat: false);
+    }
+
+    private static Task EmbeddingsAsync(HttpContext context) =>
+        WriteErrorAsync(context, StatusCodes.Status501NotImplemented,
+            "Embeddings are not supported: the OpenVINO GenAI C API does not expose an embedding pipeline",
+            "not_implemented_error");
+
+    private static async Task CompleteAsync(
+        HttpContext context,
+        string prompt,
+        int? maxTokens,
+        float? temperature,
+        float? topP,
+        JsonElement? stop,
+        bool stream,
+        bool chat)
+    {
+        var queue = context.RequestServices.GetService<InferenceQueue<LLMPipeline>>();
+        if (queue == null)
+        {
+            await WriteErrorAsync(context, StatusCodes.Status404NotFound, "No LLM model is configured", "invalid_request_error", "model_not_found");
+            return;
+        }
+
+        var options = context.RequestServices.GetRequiredService<ServerOptions>();
+        var maxNewTokens = maxTokens ?? options.DefaultMaxTokens;
+        GenerationConfig config;
+        try
+        {
+            config = CreateConfig(maxNewTokens, temperature, topP, ParseStop(stop));
+        }
+        catch (ArgumentException ex)
+        {
+            await WriteErrorAsync(context, StatusCodes.Status400BadRequest, ex.Message, "invalid_request_error");
+            return;
+        }
+
+        using (config)
+        {
+            var cancellationToken = context.RequestAborted;
+            using var lease = await queue.EnterAsync(cancellationToken);
+            if (lease == null)
+            {
+                await WriteBusyAsync(context);
+                return;
+            }
+
+            var id = (chat ? "chatcmpl-" : "cmpl-") + Guid.NewGuid().ToString("N");
+            var created = DateTimeOffset.UtcNow.ToUnixTimeSeconds();
+
+            if (stream)
+            {
+                await StreamCompletionAsync(context, lease.Pipeline, prompt, config, maxNewTokens, id, created, queue.ModelName, chat);
+                return;
+            }
+
+            using var result = await lease.Pipeline.GenerateAsync(prompt, config, cancellationToken);
+            var metrics = result.PerformanceMetrics;
+            var usage = new Usage(metrics.NumInputTokens, metrics.NumGenerationTokens, metrics.NumInputTokens + metrics.NumGenerationTokens);
+            var finishReason = metrics.NumGenerationTokens >= maxNewTokens ? "length" : "stop";
+
+            object response = chat
+                ? new ChatCompletionResponse(id, "chat.completion", created, queue.ModelName,
+                    new[] { new ChatChoice(0, new ChatMessage { Role = "assistant", Content = result.Text }, finishReason) }, usage)
+                : new CompletionResponse(id, "text_completion", created, queue.ModelName,
+                    new[] { new CompletionChoice(0, result.Text, finishReason) }, usage);
+
+            await context.Response.WriteAsJsonAsync(response, response.GetType(), cancellationToken);
+        }
+    }
+
+    private static async Task StreamCompletionAsync(
+        HttpContext context,
+        LLMPipeline pipeline,
+        string prompt,
+        GenerationConfig config,
+        int maxNewTokens,
+        string id,
+        long created,
+        string model,
+        bool chat)
+    {
+        var cancellationToken = context.RequestAborted;
+        using var sse = new SseWriter(context.Response);
+        var stream = pipeline.GenerateStreamAsync(prompt, config, new GenerationOptions(), cancellationToken);
+        var first = true;
+
+        await foreach (var token in stream)
+        {
+            WriteChunk(sse.BeginEvent(), id, created, model, chat, token, includeRole: chat && first, finishReason: null);
+            first = false;
+            if (!await sse.EndEventAsync(cancellationToken))
+                return;
+        }
+
+        // Callbacks don't map one-to-one to tokens; the metrics count what was decoded
+        var finishReason = stream.GeneratedTokens >= maxNewTokens ? "length" : "stop";
+        WriteChunk(sse.BeginEvent(), id, created, model, chat, content: null, includeRole: false, finishReason);
+        if (await sse.EndEventAsync(cancellationToken))
+        {
+            await sse.WriteDoneAsync(cancellationToken);
+        }
+    }
+
+    private static void WriteChunk(
+        Utf8JsonWriter json,
+        string id,
+        long created,
+        string model,
+        bool chat,
+        string? content,
+        bool includeRole,
+        string? finishReason)
+    {
+        json.WriteStartObject();
+        json.WriteString("id", id);
+        json.WriteString("object", chat ? "chat.completion.chunk" : "text_completion");
+        json.WriteNumber("created", created);
+        json.WriteString("model", model);
+        json.WriteStartArray("choices");
+        json.WriteStartObject();
+        json.WriteNumber("index", 0);
+
+        if (chat)
+        {
+            json.WriteStartObject("delta");
+            if (includeRole)
+                json.WriteString("role", "assistant");
+            if (content != null)
+                json.WriteString("content", content);
+            json.WriteEndObject();
+        }
+        else
+        {
+            json.WriteString("text", content ?? "");
+        }
+
+        if (finishReason != null)
+            json.WriteString("finish_reason", finishReason);
+        else
+            json.WriteNull("finish_reason");
+
+        json.WriteEndObject();
+        json.WriteEndArray();
+        json.WriteEndObject();
+    }
+
+    private static async Task TranscriptionsAsync(HttpContext context)
+    {
+        var queue = context.RequestServices.GetService<InferenceQueue<WhisperPipeline>>();
+        if (queue == null)
+        {
+            await WriteErrorAsync(context, StatusCodes.Status404NotFound, "No Whisper model is configured", "invalid_request_error", "model_not_found");
+            return;
+        }
+
+        if (!context.Request.HasFormContentType)
+        {
+            await WriteErrorAsync(context, StatusCodes.Status400BadRequest, "Expected a multipart/form-data request", "invalid_request_error");
+            return;
+        }
+
+        var cancellationToken = context.RequestAborted;
+        var form = await context.Request.ReadFormAsync(cancellationToken);
+        var file = form.Files.GetFile("file");
+        if (file == null)
+        {
+            await WriteErrorAsync(context, StatusCodes.Status400BadRequest, "'file' is required", "invalid_request_error");
+            return;
+        }
+
+        var responseFormat = form["response_format"].ToString();
+        if (responseFormat.Length == 0)
+            responseFormat = "json";
+        if (responseFormat is not ("json" or "text" or "verbose_json"))
+        {
+            await WriteErrorAsync(context, StatusCodes.Status400BadRequest, $"Unsupported response_format '{responseFormat}'", "invalid_request_error");
+            return;
+        }
+
+        var language = form["language"].ToString();
+        var initialPrompt = form["prompt"].ToString();
+        var verbose = responseFormat == "verbose_json";
+
+        float[] audio;
+        WhisperGenerationConfig? config = null;
+        try
+        {
+            audio = await ReadAudioAsync(file, cancellationToken);
+            config = new WhisperGenerationConfig().WithTask(WhisperTask.Transcribe);
+            if (language.Length > 0)
+                config.WithLanguage(language);
+            if (initialPrompt.Length > 0)
+                config.WithInitialPrompt(initialPrompt);
+            if (verbose)
+                config.WithTimestamps();
+        }
+        catch (Exception ex) when (ex is ArgumentException or NotSupportedException or InvalidDataException)
+        {
+            config?.Dispose();
+            await WriteErrorAsync(context, StatusCodes.Status400BadRequest, ex.Message, "invalid_request_error");
+            return;
+        }
+
+        using (config)
+        {
+            using var lease = await queue.EnterAsync(cancellationToken);
+            if (lease == null)
+            {
+                await WriteBusyAsync(context);
+                return;
+            }
+
+            var results = await lease.Pipeline.GenerateAsync(audio, config, cancellationToken);
+            var text = results.Count > 0 ? results[0].Text.Trim() : "";
+
+            if (responseFormat == "text")
+            {
+                context.Response.ContentType = "text/plain; charset=utf-8";
+                await context.Response.WriteAsync(text, cancellationToken);
+                return;
+            }
+
+            if (!verbose)
+            {
+                await context.Response.WriteAsJsonAsync(new TranscriptionResponse(text), cancellationToken);
+                return;
+            }
+
+            var segments = new List<TranscriptionSegment>();
+            if (results.Count > 0 && results[0].Chunks is { } chunks)
+            {
+                foreach (var chunk in chunks)
+                {
+                    segments.Add(new TranscriptionSegment(segments.Count, chunk.StartTime, chunk.EndTime, chunk.Text));
+                }
+            }
+
+            await context.Response.WriteAsJsonAsync(
+                new VerboseTranscriptionResponse("transcribe", language.Length > 0 ? language : null,
+                    (float)audio.Length / SampleRate, text, segments),
+                cancellationToken);
+        }
+    }
+
+    private static async Task<float[]> ReadAudioAsync(IFormFile file, CancellationToken cancellationToken)
+    {
+        // AudioUtils reads WAV files from disk
+        var path = Path.Combine(Path.GetTempPath(), Guid.NewGuid().ToString("N") + ".wav");
+        try
+        {
+            await using (var stream = File.Create(path))
+            {
+                await file.CopyToAsync(stream, cancellationToken);
+            }
+
+            return await AudioUtils.LoadAudioFileAsync(path, cancellationToken);
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+    }
+
+    /// <summary>
+    /// Builds the prompt of a chat request. The native pipeline applies the model's chat template
+    /// to the prompt as one user turn, so a lone user message is passed through and longer
+    /// conversations are flattened into a transcript.
+    /// </summary>
+    private static string BuildChatPrompt(IReadOnlyList<ChatMessage> messages)
+    {
+        if (messages.Count == 1 && messages[0].Role == "user")
+            return messages[0].Content ?? "";
+
+        var builder = new StringBuilder();
+        foreach (var message in messages)
+        {
+            var role = message.Role.Length > 0 ? char.ToUpperInvariant(message.Role[0]) + message.Role.Substring(1) : "User";
+            builder.Append(role).Append(": ").Append(message.Content).Append('\n');
+        }
+        builder.Append("Assistant:");
+        return builder.ToString();
+    }
+
+    private static GenerationConfig CreateConfig(int maxNewTokens, float? temperature, float? topP, string[]? stop)
+    {
+        var config = new GenerationConfig();
+        try
+        {
+            config.WithMaxTokens(maxNewTokens);
+            if (temperature is > 0)
+            {
+                config.WithSampling(true).WithTemperature(temperature.Value);
+                if (topP.HasValue)
+                    config.WithTopP(topP.Value);
+            }
+            if (stop is { Length: > 0 })
+                config.WithStopStrings(stop);
+            return config;
+        }
+        catch
+        {
+            config.Dispose();
+            throw;
+        }
+    }
+
+    private static string[]? ParseStop(JsonElement? stop)
+    {
+        if (stop is not { } element)
+            return null;
+
+        return element.ValueKind switch
+        {
+            JsonValueKind.String => new[] { element.GetString()! },
+            JsonValueKind.Array => element.EnumerateArray().Select(e => e.ValueKind == JsonValueKind.String
+                ? e.GetString()!
+                : throw new ArgumentException("'stop' must be a string or an array of strings")).ToArray(),
+            JsonValueKind.Null or JsonValueKind.Undefined => null,
+            _ => throw new ArgumentException("'stop' must be a string or an array of strings")
+        };
+    }
+
+    private static Task WriteBusyAsync(HttpContext context)
+    {
+        context.Response.Headers.RetryAfter = "1";
+        return WriteErrorAsync(context, StatusCodes.Status429TooManyRequests,
+            "The server is at capacity; retry later", "rate_limit_error", "queue_full");
+    }
+
+    private static Task WriteErrorAsync(HttpContext context, int statusCode, string message, string type, string? code = null)
+    {
+        context.Response.StatusCode = statusCode;
+        return context.Response.WriteAsJsonAsync(new ErrorResponse(new ErrorDetail(message, type, code)), context.RequestAborted);
+    }
+}
@@ -0,0 +1,50 @@
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using Fluid.OpenVINO.GenAI;
+using Fluid.OpenVINO.GenAI.Logging;
+using OpenAIServer;
+
+// OpenAI-compatible server for OpenVINO GenAI pipelines.
+//
+// Configure the models in appsettings.json or on the command line, e.g.
+//   dotnet run -- --OpenAIServer:LlmModelPath=Models/Qwen3-0.6B-fp16-ov --OpenAIServer:WhisperModelPath=Models/whisper-tiny-fp16-ov
+
+var builder = WebApplication.CreateBuilder(args);
+var options = builder.Configuration.GetSection("OpenAIServer").Get<ServerOptions>() ?? new ServerOptions();
+
+builder.Services.AddSingleton(options);
+builder.Services.ConfigureHttpJsonOptions(json =>
+{
+    json.SerializerOptions.PropertyNamingPolicy = JsonNamingPolicy.SnakeCaseLower;
+    json.SerializerOptions.DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull;
+});
+
+// One pipeline replica serves one request at a time; further requests wait in a bounded queue
+if (!string.IsNullOrEmpty(options.LlmModelPath))
+{
+    builder.Services.AddSingleton(_ => new InferenceQueue<LLMPipeline>(
+        new PipelinePool<LLMPipeline>(() => new LLMPipeline(options.LlmModelPath, options.Device), options.LlmReplicas),
+        GetModelName(options.LlmModelPath),
+        options.MaxQueueLength));
+}
+
+if (!string.IsNullOrEmpty(options.WhisperModelPath))
+{
+    builder.Services.AddSingleton(_ => new InferenceQueue<WhisperPipeline>(
+        new PipelinePool<WhisperPipeline>(() => new WhisperPipeline(options.WhisperModelPath, options.Device), options.WhisperReplicas),
+        GetModelName(options.WhisperModelPath),
+        options.MaxQueueLength));
+}
+
+var app = builder.Build();
+GenAILogging.LoggerFactory = app.Services.GetRequiredService<ILoggerFactory>();
+
+// Load the models before accepting requests
+app.Services.GetService<InferenceQueue<LLMPipeline>>();
+app.Services.GetService<InferenceQueue<WhisperPipeline>>();
+
+app.MapOpenAIEndpoints();
+app.Run();
+
+static string GetModelName(string modelPath) =>
+    Path.GetFileName(modelPath.TrimEnd(Path.DirectorySeparatorChar, Path.AltDirectorySeparatorChar));
@@ -0,0 +1,42 @@
+namespace OpenAIServer;
+
+/// <summary>
+/// Server settings, bound from the "OpenAIServer" configuration section
+/// </summary>
+public sealed class ServerOptions
+{
+    /// <summary>
+    /// Gets or sets the LLM model directory; chat and text completions are disabled when empty
+    /// </summary>
+    public string? LlmModelPath { get; set; }
+
+    /// <summary>
+    /// Gets or sets the Whisper model directory; transcriptions are disabled when empty
+    /// </summary>
+    public string? WhisperModelPath { get; set; }
+
+    /// <summary>
+    /// Gets or sets the device the pipelines run on
+    /// </summary>
+    public string Device { get; set; } = "CPU";
+
+    /// <summary>
+    /// Gets or sets the number of LLM pipelines, i.e. the number of concurrent completions
+    /// </summary>
+    public int LlmReplicas { get; set; } = 1;
+
+    /// <summary>
+    /// Gets or sets the number of Whisper pipelines, i.e. the number of concurrent transcriptions
+    /// </summary>
+    public int WhisperReplicas { get; set; } = 1;
+
+    /// <summary>
+    /// Gets or sets how many requests per model may wait for a pipeline before new ones are rejected with 429
+    /// </summary>
+    public int MaxQueueLength { get; set; } = 16;
+
+    /// <summary>
+    /// Gets or sets the completion length used when a request does not set max_tokens
+    /// </summary>
+    public int DefaultMaxTokens { get; set; } = 256;
+}
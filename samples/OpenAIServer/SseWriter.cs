@@ -0,0 +1,66 @@
+using System.Buffers;
+using System.IO.Pipelines;
+using System.Text.Json;
+
+namespace OpenAIServer;
+
+/// <summary>
+/// Writes server-sent events as UTF-8 directly into the response pipe, without intermediate strings
+/// </summary>
+public sealed class SseWriter : IDisposable
+{
+    private readonly PipeWriter _output;
+    private readonly Utf8JsonWriter _json;
+
+    /// <summary>
+    /// Initializes a new instance of the SseWriter class and sets the event-stream headers
+    /// </summary>
+    /// <param name="response">The response to write to</param>
+    public SseWriter(HttpResponse response)
+    {
+        response.ContentType = "text/event-stream";
+        response.Headers.CacheControl = "no-cache";
+        response.Headers["X-Accel-Buffering"] = "no";
+
+        _output = response.BodyWriter;
+        _json = new Utf8JsonWriter(_output);
+    }
+
+    /// <summary>
+    /// Starts a data event and returns the writer for its JSON payload
+    /// </summary>
+    public Utf8JsonWriter BeginEvent()
+    {
+        _output.Write("data: "u8);
+        _json.Reset(_output);
+        return _json;
+    }
+
+    /// <summary>
+    /// Completes the current event and sends it to the client
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>False if the client has disconnected</returns>
+    public async ValueTask<bool> EndEventAsync(CancellationToken cancellationToken)
+    {
+        _json.Flush();
+        _output.Write("\n\n"u8);
+        var result = await _output.FlushAsync(cancellationToken);
+        return !result.IsCompleted && !result.IsCanceled;
+    }
+
+    /// <summary>
+    /// Sends the terminating "[DONE]" event
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    public async ValueTask WriteDoneAsync(CancellationToken cancellationToken)
+    {
+        _output.Write("data: [DONE]\n\n"u8);
+        await _output.FlushAsync(cancellationToken);
+    }
+
+    /// <summary>
+    /// Releases the JSON writer; the response pipe is owned by the server
+    /// </summary>
+    public void Dispose() => _json.Dispose();
+}
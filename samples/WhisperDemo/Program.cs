@@ -63,6 +63,17 @@ class Program
                 Console.WriteLine($"  {result.Text}");
                 Console.WriteLine($"  Score: {result.Score:F4}");
             }
+
+            var metrics = results.Count > 0 ? results[0].PerformanceMetrics : null;
+            if (metrics != null)
+            {
+                Console.WriteLine("\nPerformance:");
+                Console.WriteLine($"  Audio duration:        {metrics.AudioDuration:F2} s");
+                Console.WriteLine($"  Total time:            {metrics.GenerateDuration:F1} ms (RTF {metrics.RealTimeFactor:F3})");
+                Console.WriteLine($"  Front-end + encoder:   {metrics.FeatureExtractionAndEncodeTime:F1} ms (estimated)");
+                Console.WriteLine($"  Time to first token:   {metrics.TimeToFirstToken:F1} ms");
+                Console.WriteLine($"  Time per output token: {metrics.TimePerOutputToken:F1} ms");
+            }
         }
         catch (Exception ex)
         {
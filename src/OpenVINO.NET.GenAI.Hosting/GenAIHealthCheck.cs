@@ -0,0 +1,62 @@
+using Microsoft.Extensions.Diagnostics.HealthChecks;
+
+namespace Fluid.OpenVINO.GenAI.Hosting;
+
+/// <summary>
+/// Reports the load state and queue saturation of the registered pipelines
+/// </summary>
+/// <remarks>
+/// Unhealthy while any pool is loading or has failed to load. Degraded when a pool has at
+/// least as many waiting callers as replicas, i.e. new requests wait for a full generation.
+/// </remarks>
+public sealed class GenAIHealthCheck : IHealthCheck
+{
+    private readonly GenAIPipelineRegistry _registry;
+
+    /// <summary>
+    /// Initializes a new instance of the GenAIHealthCheck class
+    /// </summary>
+    /// <param name="registry">The registered pipelines</param>
+    public GenAIHealthCheck(GenAIPipelineRegistry registry)
+    {
+        _registry = registry ?? throw new ArgumentNullException(nameof(registry));
+    }
+
+    /// <summary>
+    /// Checks the registered pipelines
+    /// </summary>
+    public Task<HealthCheckResult> CheckHealthAsync(HealthCheckContext context, CancellationToken cancellationToken = default)
+    {
+        var data = new Dictionary<string, object>();
+        var problems = new List<string>();
+        var status = HealthStatus.Healthy;
+
+        foreach (var entry in _registry.Entries)
+        {
+            var state = entry.State;
+            data[entry.Name + ".state"] = state.ToString();
+            data[entry.Name + ".replicas"] = entry.Replicas;
+            data[entry.Name + ".available"] = entry.Available;
+            data[entry.Name + ".waiting"] = entry.Waiting;
+            if (entry.LoadDuration is { } loadDuration)
+                data[entry.Name + ".loadMilliseconds"] = (long)loadDuration.TotalMilliseconds;
+
+            if (state != PipelineLoadState.Ready)
+            {
+                status = context.Registration?.FailureStatus ?? HealthStatus.Unhealthy;
+                problems.Add(state == PipelineLoadState.Failed
+                    ? $"{entry.Name} failed to load: {entry.Error?.Message}"
+                    : $"{entry.Name} is {state.ToString().ToLowerInvariant()}");
+            }
+            else if (entry.Waiting >= entry.Replicas)
+            {
+                if (status == HealthStatus.Healthy)
+                    status = HealthStatus.Degraded;
+                problems.Add($"{entry.Name} is saturated ({entry.Waiting} waiting for {entry.Replicas} replicas)");
+            }
+        }
+
+        var description = problems.Count > 0 ? string.Join("; ", problems) : "All pipelines are ready";
+        return Task.FromResult(new HealthCheckResult(status, description, data: data));
+    }
+}
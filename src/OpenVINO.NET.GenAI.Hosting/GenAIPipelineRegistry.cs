@@ -0,0 +1,91 @@
+using Fluid.OpenVINO.GenAI.Logging;
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI.Hosting;
+
+/// <summary>
+/// The named pipeline pools registered with <see cref="GenAIServiceCollectionExtensions.AddOpenVINOGenAI(Microsoft.Extensions.DependencyInjection.IServiceCollection, Action{OpenVINOGenAIOptions})"/>
+/// </summary>
+public sealed class GenAIPipelineRegistry : IDisposable
+{
+    private readonly Dictionary<string, PipelineEntry> _entries = new(StringComparer.Ordinal);
+    private bool _disposed;
+
+    /// <summary>
+    /// Initializes a new instance of the GenAIPipelineRegistry class
+    /// </summary>
+    /// <param name="options">The registered pipelines</param>
+    /// <param name="loggerFactory">Logger factory of the host</param>
+    public GenAIPipelineRegistry(OpenVINOGenAIOptions options, ILoggerFactory loggerFactory)
+    {
+        if (options == null)
+            throw new ArgumentNullException(nameof(options));
+        if (loggerFactory == null)
+            throw new ArgumentNullException(nameof(loggerFactory));
+
+        if (options.UseHostLogging)
+        {
+            GenAILogging.LoggerFactory = loggerFactory;
+        }
+
+        var logger = loggerFactory.CreateLogger<GenAIPipelineRegistry>();
+        foreach (var registration in options.Registrations)
+        {
+            var entry = registration.CreateEntry();
+            entry.Logger = logger;
+            _entries.Add(registration.Name, entry);
+        }
+    }
+
+    /// <summary>
+    /// Gets all registered entries
+    /// </summary>
+    public IReadOnlyCollection<PipelineEntry> Entries => _entries.Values;
+
+    /// <summary>
+    /// Gets a registered entry by name
+    /// </summary>
+    /// <typeparam name="TPipeline">Pipeline type of the registration</typeparam>
+    /// <param name="name">Registration name</param>
+    /// <returns>The entry</returns>
+    public PipelineEntry<TPipeline> Get<TPipeline>(string name) where TPipeline : class, IDisposable
+    {
+        ThrowIfDisposed();
+        if (!_entries.TryGetValue(name, out var entry))
+            throw new KeyNotFoundException($"No pipeline named '{name}' is registered");
+
+        return entry as PipelineEntry<TPipeline>
+            ?? throw new InvalidOperationException($"Pipeline '{name}' is a {entry.PipelineType.Name}, not a {typeof(TPipeline).Name}");
+    }
+
+    /// <summary>
+    /// Loads and warms up all registered pools in parallel
+    /// </summary>
+    /// <param name="cancellationToken">Cancels the wait; ongoing loads continue</param>
+    public Task LoadAllAsync(CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+        return Task.WhenAll(_entries.Values.Select(e => e.EnsureLoadedAsync(cancellationToken)));
+    }
+
+    private void ThrowIfDisposed()
+    {
+        if (_disposed)
+            throw new ObjectDisposedException(nameof(GenAIPipelineRegistry));
+    }
+
+    /// <summary>
+    /// Releases all pools and their replicas
+    /// </summary>
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+
+        _disposed = true;
+        foreach (var entry in _entries.Values)
+        {
+            entry.Dispose();
+        }
+    }
+}
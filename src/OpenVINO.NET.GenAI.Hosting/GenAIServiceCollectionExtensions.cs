@@ -0,0 +1,65 @@
+using Microsoft.Extensions.DependencyInjection;
+using Microsoft.Extensions.Diagnostics.HealthChecks;
+
+namespace Fluid.OpenVINO.GenAI.Hosting;
+
+/// <summary>
+/// Registers OpenVINO GenAI pipelines with dependency injection
+/// </summary>
+public static class GenAIServiceCollectionExtensions
+{
+    /// <summary>
+    /// Registers named pipeline pools as singletons and loads them when the host starts
+    /// </summary>
+    /// <remarks>
+    /// Each registration is available as a keyed <see cref="PipelinePool{TPipeline}"/> and
+    /// <see cref="PipelineEntry{TPipeline}"/> under its name. The first registration of each
+    /// pipeline type is also registered without a key.
+    /// </remarks>
+    /// <param name="services">The service collection</param>
+    /// <param name="configure">Registers the pipelines</param>
+    /// <returns>The service collection for chaining</returns>
+    public static IServiceCollection AddOpenVINOGenAI(this IServiceCollection services, Action<OpenVINOGenAIOptions> configure)
+    {
+        if (services == null)
+            throw new ArgumentNullException(nameof(services));
+        if (configure == null)
+            throw new ArgumentNullException(nameof(configure));
+        if (services.Any(d => d.ServiceType == typeof(OpenVINOGenAIOptions)))
+            throw new InvalidOperationException("AddOpenVINOGenAI can only be called once; register all pipelines in one call");
+
+        var options = new OpenVINOGenAIOptions();
+        configure(options);
+
+        services.AddSingleton(options);
+        services.AddSingleton<GenAIPipelineRegistry>();
+        services.AddHostedService<PipelineWarmupService>();
+
+        foreach (var registration in options.Registrations)
+        {
+            registration.AddServices(services);
+        }
+
+        return services;
+    }
+
+    /// <summary>
+    /// Adds a health check that reports the load state and queue saturation of the registered pipelines
+    /// </summary>
+    /// <param name="builder">The health checks builder</param>
+    /// <param name="name">Health check name</param>
+    /// <param name="failureStatus">Status reported while a pipeline is not ready (default Unhealthy)</param>
+    /// <param name="tags">Tags used to filter health checks</param>
+    /// <returns>The builder for chaining</returns>
+    public static IHealthChecksBuilder AddOpenVINOGenAI(
+        this IHealthChecksBuilder builder,
+        string name = "openvino-genai",
+        HealthStatus? failureStatus = null,
+        IEnumerable<string>? tags = null)
+    {
+        if (builder == null)
+            throw new ArgumentNullException(nameof(builder));
+
+        return builder.AddCheck<GenAIHealthCheck>(name, failureStatus, tags ?? Array.Empty<string>());
+    }
+}
@@ -0,0 +1,18 @@
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI.Hosting;
+
+/// <summary>
+/// Source-generated log messages of the hosting integration
+/// </summary>
+internal static partial class Log
+{
+    [LoggerMessage(EventId = 500, Level = LogLevel.Information, Message = "Loading pipeline {Name} with {Replicas} replicas")]
+    internal static partial void PipelineLoading(ILogger logger, string name, int replicas);
+
+    [LoggerMessage(EventId = 501, Level = LogLevel.Information, Message = "Pipeline {Name} is ready after {ElapsedMilliseconds} ms")]
+    internal static partial void PipelineLoaded(ILogger logger, string name, long elapsedMilliseconds);
+
+    [LoggerMessage(EventId = 502, Level = LogLevel.Error, Message = "Pipeline {Name} failed to load")]
+    internal static partial void PipelineLoadFailed(ILogger logger, string name, Exception exception);
+}
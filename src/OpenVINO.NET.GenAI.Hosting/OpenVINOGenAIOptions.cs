@@ -0,0 +1,188 @@
+using Microsoft.Extensions.DependencyInjection;
+using Microsoft.Extensions.DependencyInjection.Extensions;
+
+namespace Fluid.OpenVINO.GenAI.Hosting;
+
+/// <summary>
+/// Pipelines registered with <see cref="GenAIServiceCollectionExtensions.AddOpenVINOGenAI(Microsoft.Extensions.DependencyInjection.IServiceCollection, Action{OpenVINOGenAIOptions})"/>
+/// </summary>
+public sealed class OpenVINOGenAIOptions
+{
+    private readonly List<PipelineRegistration> _registrations = new();
+
+    /// <summary>
+    /// Gets the registered pipelines
+    /// </summary>
+    public IReadOnlyList<PipelineRegistration> Registrations => _registrations;
+
+    /// <summary>
+    /// Gets or sets whether host startup waits until all pipelines are loaded and warmed up.
+    /// When false, pipelines load in the background and the health check reports them as unhealthy until ready.
+    /// </summary>
+    public bool WaitForLoadOnStartup { get; set; } = true;
+
+    /// <summary>
+    /// Gets or sets whether library diagnostics are routed to the host's logger factory
+    /// </summary>
+    public bool UseHostLogging { get; set; } = true;
+
+    /// <summary>
+    /// Registers a pool of LLM pipelines
+    /// </summary>
+    /// <param name="name">Registration name, used as the service key</param>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="device">Target device</param>
+    /// <param name="replicas">Number of pipelines in the pool</param>
+    /// <param name="properties">Device properties (optional)</param>
+    /// <param name="partitionAcrossNumaNodes">Whether replicas are spread across NUMA nodes, each pinned to its own cores</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public OpenVINOGenAIOptions AddLLMPipeline(
+        string name,
+        string modelPath,
+        string device = "CPU",
+        int replicas = 1,
+        PipelineProperties? properties = null,
+        bool partitionAcrossNumaNodes = false)
+    {
+        if (string.IsNullOrEmpty(modelPath))
+            throw new ArgumentException("Model path cannot be null or empty", nameof(modelPath));
+
+        var placements = CreatePlacements(replicas, partitionAcrossNumaNodes);
+        return AddPipeline(name, () => new LLMPipeline(modelPath, device, properties, placements?.Invoke()), replicas, WarmupLLM);
+    }
+
+    /// <summary>
+    /// Registers a pool of Whisper pipelines
+    /// </summary>
+    /// <param name="name">Registration name, used as the service key</param>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="device">Target device</param>
+    /// <param name="replicas">Number of pipelines in the pool</param>
+    /// <param name="properties">Device properties (optional)</param>
+    /// <param name="partitionAcrossNumaNodes">Whether replicas are spread across NUMA nodes, each pinned to its own cores</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public OpenVINOGenAIOptions AddWhisperPipeline(
+        string name,
+        string modelPath,
+        string device = "CPU",
+        int replicas = 1,
+        PipelineProperties? properties = null,
+        bool partitionAcrossNumaNodes = false)
+    {
+        if (string.IsNullOrEmpty(modelPath))
+            throw new ArgumentException("Model path cannot be null or empty", nameof(modelPath));
+
+        var placements = CreatePlacements(replicas, partitionAcrossNumaNodes);
+        return AddPipeline(name, () => new WhisperPipeline(modelPath, device, properties, placements?.Invoke()), replicas, WarmupWhisper);
+    }
+
+    /// <summary>
+    /// Registers a pool of pipelines created by a factory
+    /// </summary>
+    /// <typeparam name="TPipeline">Pipeline type</typeparam>
+    /// <param name="name">Registration name, used as the service key</param>
+    /// <param name="factory">Factory that creates one replica</param>
+    /// <param name="replicas">Number of pipelines in the pool</param>
+    /// <param name="warmup">Action run once on each new replica before it is pooled (optional)</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public OpenVINOGenAIOptions AddPipeline<TPipeline>(
+        string name,
+        Func<TPipeline> factory,
+        int replicas = 1,
+        Action<TPipeline>? warmup = null) where TPipeline : class, IDisposable
+    {
+        if (string.IsNullOrEmpty(name))
+            throw new ArgumentException("Registration name cannot be null or empty", nameof(name));
+        if (factory == null)
+            throw new ArgumentNullException(nameof(factory));
+        if (replicas <= 0)
+            throw new ArgumentOutOfRangeException(nameof(replicas), "Number of replicas must be positive");
+        if (_registrations.Any(r => string.Equals(r.Name, name, StringComparison.Ordinal)))
+            throw new ArgumentException($"A pipeline named '{name}' is already registered", nameof(name));
+
+        _registrations.Add(new PipelineRegistration(
+            name,
+            typeof(TPipeline),
+            replicas,
+            () => new PipelineEntry<TPipeline>(name, factory, replicas, warmup),
+            services =>
+            {
+                services.AddKeyedSingleton(name, (sp, _) => sp.GetRequiredService<GenAIPipelineRegistry>().Get<TPipeline>(name));
+                services.AddKeyedSingleton(name, (sp, _) => sp.GetRequiredKeyedService<PipelineEntry<TPipeline>>(name).GetPool());
+
+                // The first registration of a pipeline type is also its unkeyed default
+                services.TryAddSingleton(sp => sp.GetRequiredKeyedService<PipelinePool<TPipeline>>(name));
+            }));
+        return this;
+    }
+
+    /// <summary>
+    /// Returns a function that hands out NUMA placements in turn, or null when not partitioning.
+    /// Replicas load in parallel and failed replicas are recreated, so placements cycle.
+    /// </summary>
+    private static Func<ReplicaPlacement>? CreatePlacements(int replicas, bool partitionAcrossNumaNodes)
+    {
+        if (!partitionAcrossNumaNodes)
+            return null;
+
+        var placements = ReplicaPlacement.Partition(replicas);
+        var next = -1;
+        return () => placements[(int)((uint)Interlocked.Increment(ref next) % (uint)placements.Count)];
+    }
+
+    /// <summary>
+    /// Compiles the LLM's first-token path by generating a single token
+    /// </summary>
+    private static void WarmupLLM(LLMPipeline pipeline)
+    {
+        using var config = new GenerationConfig().WithMaxTokens(1);
+        using var result = pipeline.Generate("Hello", config);
+    }
+
+    /// <summary>
+    /// Runs the encoder and decoder once on a second of silence
+    /// </summary>
+    private static void WarmupWhisper(WhisperPipeline pipeline)
+    {
+        pipeline.Generate(new float[16000]);
+    }
+}
+
+/// <summary>
+/// A named pipeline pool registration
+/// </summary>
+public sealed class PipelineRegistration
+{
+    internal PipelineRegistration(
+        string name,
+        Type pipelineType,
+        int replicas,
+        Func<PipelineEntry> createEntry,
+        Action<IServiceCollection> addServices)
+    {
+        Name = name;
+        PipelineType = pipelineType;
+        Replicas = replicas;
+        CreateEntry = createEntry;
+        AddServices = addServices;
+    }
+
+    /// <summary>
+    /// Gets the registration name
+    /// </summary>
+    public string Name { get; }
+
+    /// <summary>
+    /// Gets the pipeline type
+    /// </summary>
+    public Type PipelineType { get; }
+
+    /// <summary>
+    /// Gets the number of replicas
+    /// </summary>
+    public int Replicas { get; }
+
+    internal Func<PipelineEntry> CreateEntry { get; }
+
+    internal Action<IServiceCollection> AddServices { get; }
+}
@@ -0,0 +1,290 @@
+using System.Diagnostics;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Abstractions;
+
+namespace Fluid.OpenVINO.GenAI.Hosting;
+
+/// <summary>
+/// Load state of a registered pipeline pool
+/// </summary>
+public enum PipelineLoadState
+{
+    /// <summary>
+    /// Loading has not started
+    /// </summary>
+    NotLoaded,
+
+    /// <summary>
+    /// Replicas are being created and warmed up
+    /// </summary>
+    Loading,
+
+    /// <summary>
+    /// The pool is ready to serve requests
+    /// </summary>
+    Ready,
+
+    /// <summary>
+    /// The last load attempt failed; the next request retries it
+    /// </summary>
+    Failed
+}
+
+/// <summary>
+/// A registered pipeline pool and its load state
+/// </summary>
+public abstract class PipelineEntry : IDisposable
+{
+    private protected PipelineEntry(string name, int replicas)
+    {
+        Name = name;
+        Replicas = replicas;
+    }
+
+    /// <summary>
+    /// Gets the registration name
+    /// </summary>
+    public string Name { get; }
+
+    /// <summary>
+    /// Gets the number of replicas
+    /// </summary>
+    public int Replicas { get; }
+
+    /// <summary>
+    /// Gets the pipeline type
+    /// </summary>
+    public abstract Type PipelineType { get; }
+
+    /// <summary>
+    /// Gets the load state
+    /// </summary>
+    public abstract PipelineLoadState State { get; }
+
+    /// <summary>
+    /// Gets the error of the last failed load, if any
+    /// </summary>
+    public abstract Exception? Error { get; }
+
+    /// <summary>
+    /// Gets the time the last successful load took, including warmup
+    /// </summary>
+    public abstract TimeSpan? LoadDuration { get; }
+
+    /// <summary>
+    /// Gets the number of idle replicas, or 0 if the pool is not loaded
+    /// </summary>
+    public abstract int Available { get; }
+
+    /// <summary>
+    /// Gets the number of callers waiting for a replica, or 0 if the pool is not loaded
+    /// </summary>
+    public abstract int Waiting { get; }
+
+    /// <summary>
+    /// Gets or sets the logger that reports loading
+    /// </summary>
+    internal ILogger Logger { get; set; } = NullLogger.Instance;
+
+    /// <summary>
+    /// Loads the pool if it is not loaded yet
+    /// </summary>
+    internal abstract Task EnsureLoadedAsync(CancellationToken cancellationToken);
+
+    /// <summary>
+    /// Releases the pool and its replicas
+    /// </summary>
+    public abstract void Dispose();
+}
+
+/// <summary>
+/// A registered pool of <typeparamref name="TPipeline"/> replicas
+/// </summary>
+/// <typeparam name="TPipeline">Pipeline type</typeparam>
+public sealed class PipelineEntry<TPipeline> : PipelineEntry where TPipeline : class, IDisposable
+{
+    private readonly Func<TPipeline> _factory;
+    private readonly Action<TPipeline>? _warmup;
+    private readonly object _lock = new();
+    private Task<PipelinePool<TPipeline>>? _loadTask;
+    private Exception? _error;
+    private TimeSpan? _loadDuration;
+    private bool _disposed;
+
+    internal PipelineEntry(string name, Func<TPipeline> factory, int replicas, Action<TPipeline>? warmup)
+        : base(name, replicas)
+    {
+        _factory = factory;
+        _warmup = warmup;
+    }
+
+    /// <inheritdoc/>
+    public override Type PipelineType => typeof(TPipeline);
+
+    /// <inheritdoc/>
+    public override PipelineLoadState State
+    {
+        get
+        {
+            var task = Volatile.Read(ref _loadTask);
+            if (task == null)
+                return PipelineLoadState.NotLoaded;
+            if (task.Status == TaskStatus.RanToCompletion)
+                return PipelineLoadState.Ready;
+            return task.IsFaulted || task.IsCanceled ? PipelineLoadState.Failed : PipelineLoadState.Loading;
+        }
+    }
+
+    /// <inheritdoc/>
+    public override Exception? Error => Volatile.Read(ref _error);
+
+    /// <inheritdoc/>
+    public override TimeSpan? LoadDuration => _loadDuration;
+
+    /// <inheritdoc/>
+    public override int Available => TryGetPool(out var pool) ? pool.Available : 0;
+
+    /// <inheritdoc/>
+    public override int Waiting => TryGetPool(out var pool) ? pool.Waiting : 0;
+
+    /// <summary>
+    /// Gets the pool, waiting for it to load if necessary
+    /// </summary>
+    /// <param name="cancellationToken">Cancels the wait; an ongoing load continues</param>
+    /// <returns>The loaded pool</returns>
+    public Task<PipelinePool<TPipeline>> GetPoolAsync(CancellationToken cancellationToken = default)
+    {
+        var task = GetOrStartLoad();
+        return task.IsCompleted || !cancellationToken.CanBeCanceled ? task : WaitAsync(task, cancellationToken);
+    }
+
+    /// <summary>
+    /// Gets the pool, blocking until it is loaded
+    /// </summary>
+    /// <returns>The loaded pool</returns>
+    public PipelinePool<TPipeline> GetPool() => GetOrStartLoad().GetAwaiter().GetResult();
+
+    internal override Task EnsureLoadedAsync(CancellationToken cancellationToken) => GetPoolAsync(cancellationToken);
+
+    private bool TryGetPool(out PipelinePool<TPipeline> pool)
+    {
+        var task = Volatile.Read(ref _loadTask);
+        if (task != null && task.Status == TaskStatus.RanToCompletion)
+        {
+            pool = task.Result;
+            return true;
+        }
+
+        pool = null!;
+        return false;
+    }
+
+    private Task<PipelinePool<TPipeline>> GetOrStartLoad()
+    {
+        lock (_lock)
+        {
+            if (_disposed)
+                throw new ObjectDisposedException(nameof(PipelineEntry<TPipeline>));
+
+            // A failed load is retried by the next caller
+            if (_loadTask == null || _loadTask.IsFaulted || _loadTask.IsCanceled)
+            {
+                Volatile.Write(ref _loadTask, LoadAsync());
+            }
+
+            return _loadTask;
+        }
+    }
+
+    private async Task<PipelinePool<TPipeline>> LoadAsync()
+    {
+        await Task.Yield();
+
+        Log.PipelineLoading(Logger, Name, Replicas);
+
+        var stopwatch = Stopwatch.StartNew();
+
+        // Replicas compile and warm up in parallel; each warmup runs before the replica is pooled
+        var tasks = new Task<TPipeline>[Replicas];
+        for (int i = 0; i < tasks.Length; i++)
+        {
+            tasks[i] = Task.Run(CreateReplica);
+        }
+
+        try
+        {
+            await Task.WhenAll(tasks).ConfigureAwait(false);
+        }
+        catch (Exception ex)
+        {
+            foreach (var task in tasks)
+            {
+                if (task.Status == TaskStatus.RanToCompletion)
+                    task.Result.Dispose();
+            }
+
+            Volatile.Write(ref _error, ex);
+            Log.PipelineLoadFailed(Logger, Name, ex);
+            throw;
+        }
+
+        _loadDuration = stopwatch.Elapsed;
+        Volatile.Write(ref _error, null);
+        Log.PipelineLoaded(Logger, Name, stopwatch.ElapsedMilliseconds);
+
+        return new PipelinePool<TPipeline>(tasks.Select(t => t.Result));
+    }
+
+    private TPipeline CreateReplica()
+    {
+        var pipeline = _factory();
+        try
+        {
+            _warmup?.Invoke(pipeline);
+            return pipeline;
+        }
+        catch
+        {
+            pipeline.Dispose();
+            throw;
+        }
+    }
+
+    private static async Task<PipelinePool<TPipeline>> WaitAsync(Task<PipelinePool<TPipeline>> task, CancellationToken cancellationToken)
+    {
+        var cancelled = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+        using (cancellationToken.Register(() => cancelled.TrySetResult(true)))
+        {
+            if (await Task.WhenAny(task, cancelled.Task).ConfigureAwait(false) != task)
+                throw new OperationCanceledException(cancellationToken);
+        }
+
+        return await task.ConfigureAwait(false);
+    }
+
+    /// <inheritdoc/>
+    public override void Dispose()
+    {
+        Task<PipelinePool<TPipeline>>? task;
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            task = _loadTask;
+        }
+
+        if (task == null)
+            return;
+
+        // Wait for an ongoing load so its replicas are not leaked
+        try
+        {
+            task.GetAwaiter().GetResult().Dispose();
+        }
+        catch (Exception) when (task.IsFaulted || task.IsCanceled)
+        {
+        }
+    }
+}
@@ -0,0 +1,38 @@
+using Microsoft.Extensions.Hosting;
+
+namespace Fluid.OpenVINO.GenAI.Hosting;
+
+/// <summary>
+/// Loads and warms up all registered pipelines when the host starts, so the first request
+/// does not pay for model compilation
+/// </summary>
+internal sealed class PipelineWarmupService : IHostedService
+{
+    private readonly GenAIPipelineRegistry _registry;
+    private readonly OpenVINOGenAIOptions _options;
+
+    public PipelineWarmupService(GenAIPipelineRegistry registry, OpenVINOGenAIOptions options)
+    {
+        _registry = registry;
+        _options = options;
+    }
+
+    public Task StartAsync(CancellationToken cancellationToken)
+    {
+        if (_options.WaitForLoadOnStartup)
+        {
+            // Hosted services start before the server accepts requests
+            return _registry.LoadAllAsync(cancellationToken);
+        }
+
+        // Failures are logged by the entries and reported by the health check
+        _ = _registry.LoadAllAsync().ContinueWith(
+            t => _ = t.Exception,
+            CancellationToken.None,
+            TaskContinuationOptions.OnlyOnFaulted | TaskContinuationOptions.ExecuteSynchronously,
+            TaskScheduler.Default);
+        return Task.CompletedTask;
+    }
+
+    public Task StopAsync(CancellationToken cancellationToken) => Task.CompletedTask;
+}
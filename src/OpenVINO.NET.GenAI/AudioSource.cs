@@ -0,0 +1,75 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// An audio input for batch transcription: either a file or in-memory samples
+/// </summary>
+public sealed class AudioSource
+{
+    private readonly string? _filePath;
+    private readonly float[]? _samples;
+
+    private AudioSource(string id, string? filePath, float[]? samples)
+    {
+        Id = id;
+        _filePath = filePath;
+        _samples = samples;
+    }
+
+    /// <summary>
+    /// Gets the caller-defined identifier of this source (defaults to the file path)
+    /// </summary>
+    public string Id { get; }
+
+    /// <summary>
+    /// Gets the file path, or null for in-memory samples
+    /// </summary>
+    public string? FilePath => _filePath;
+
+    /// <summary>
+    /// Creates a source that reads a WAV file
+    /// </summary>
+    /// <param name="filePath">Path to audio file (WAV format)</param>
+    /// <param name="id">Optional identifier; defaults to the file path</param>
+    /// <returns>The audio source</returns>
+    public static AudioSource FromFile(string filePath, string? id = null)
+    {
+        if (string.IsNullOrEmpty(filePath))
+            throw new ArgumentException("Audio file path cannot be null or empty", nameof(filePath));
+
+        return new AudioSource(id ?? filePath, filePath, null);
+    }
+
+    /// <summary>
+    /// Creates a source from raw samples
+    /// </summary>
+    /// <param name="samples">Raw audio data (16kHz, mono, normalized to [-1, 1])</param>
+    /// <param name="id">Identifier reported back with the result</param>
+    /// <returns>The audio source</returns>
+    public static AudioSource FromSamples(float[] samples, string id)
+    {
+        if (samples == null)
+            throw new ArgumentNullException(nameof(samples));
+        if (id == null)
+            throw new ArgumentNullException(nameof(id));
+
+        return new AudioSource(id, null, samples);
+    }
+
+    /// <summary>
+    /// Loads the samples of this source
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Audio data as float array (16kHz, mono, normalized to [-1, 1])</returns>
+    public async Task<float[]> LoadAsync(CancellationToken cancellationToken = default)
+    {
+        if (_samples != null)
+            return _samples;
+
+        return await AudioUtils.LoadAudioFileAsync(_filePath!, cancellationToken);
+    }
+
+    /// <summary>
+    /// Returns the identifier of this source
+    /// </summary>
+    public override string ToString() => Id;
+}
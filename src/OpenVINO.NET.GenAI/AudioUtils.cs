@@ -5,7 +5,7 @@ namespace Fluid.OpenVINO.GenAI;
 /// </summary>
 public static class AudioUtils
 {
-    private const int WhisperSampleRate = 16000;
+    internal const int WhisperSampleRate = 16000;
 
     /// <summary>
     /// Loads audio from a file and converts it to the format expected by Whisper
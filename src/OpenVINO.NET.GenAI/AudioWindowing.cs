@@ -0,0 +1,92 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Splits long audio into Whisper-sized windows, cutting at the quietest point
+/// near each window boundary so words are not split across windows
+/// </summary>
+internal static class AudioWindowing
+{
+    /// <summary>
+    /// Whisper encoder window length in samples (30 seconds at 16 kHz)
+    /// </summary>
+    internal const int WindowSamples = 30 * AudioUtils.WhisperSampleRate;
+
+    // Search the last 2 seconds of a window in 20 ms frames for a cut point
+    private const int SearchSamples = 2 * AudioUtils.WhisperSampleRate;
+    private const int FrameSamples = AudioUtils.WhisperSampleRate / 50;
+
+    /// <summary>
+    /// Splits audio into consecutive windows of at most <paramref name="maxWindowSamples"/> samples
+    /// </summary>
+    /// <param name="audio">Audio samples (16kHz, mono)</param>
+    /// <param name="maxWindowSamples">Maximum window length in samples</param>
+    /// <returns>Window (offset, length) pairs covering the whole input</returns>
+    internal static List<(int Offset, int Length)> Split(ReadOnlySpan<float> audio, int maxWindowSamples = WindowSamples)
+    {
+        var windows = new List<(int Offset, int Length)>(audio.Length / maxWindowSamples + 1);
+        var offset = 0;
+
+        while (audio.Length - offset > maxWindowSamples)
+        {
+            var length = FindCut(audio.Slice(offset, maxWindowSamples));
+            windows.Add((offset, length));
+            offset += length;
+        }
+
+        if (offset < audio.Length)
+        {
+            windows.Add((offset, audio.Length - offset));
+        }
+
+        return windows;
+    }
+
+    /// <summary>
+    /// Gets the start time of a sample offset in seconds
+    /// </summary>
+    internal static float ToSeconds(int samples) => (float)samples / AudioUtils.WhisperSampleRate;
+
+    /// <summary>
+    /// Gets the RMS level of the audio in dBFS
+    /// </summary>
+    internal static float RmsDbfs(ReadOnlySpan<float> audio)
+    {
+        if (audio.IsEmpty)
+            return float.NegativeInfinity;
+
+        double energy = 0;
+        for (int i = 0; i < audio.Length; i++)
+        {
+            energy += audio[i] * audio[i];
+        }
+
+        var rms = Math.Sqrt(energy / audio.Length);
+        return rms > 0 ? (float)(20 * Math.Log10(rms)) : float.NegativeInfinity;
+    }
+
+    private static int FindCut(ReadOnlySpan<float> window)
+    {
+        var searchStart = Math.Max(0, window.Length - Math.Min(SearchSamples, window.Length / 2));
+        var bestEnd = window.Length;
+        var bestEnergy = float.MaxValue;
+
+        for (int frameStart = searchStart; frameStart + FrameSamples <= window.Length; frameStart += FrameSamples)
+        {
+            var frame = window.Slice(frameStart, FrameSamples);
+            float energy = 0;
+            for (int i = 0; i < frame.Length; i++)
+            {
+                energy += frame[i] * frame[i];
+            }
+
+            // Prefer later frames on ties to keep windows as long as possible
+            if (energy <= bestEnergy)
+            {
+                bestEnergy = energy;
+                bestEnd = frameStart + FrameSamples / 2;
+            }
+        }
+
+        return bestEnd;
+    }
+}
@@ -0,0 +1,49 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Bounds the KV cache of a chat session by evicting the middle of the conversation
+/// </summary>
+/// <remarks>
+/// When the cached context would exceed <see cref="MaxCacheSize"/> tokens, the session keeps the
+/// turns that fit in the first <see cref="StartSize"/> tokens and the last <see cref="RecentSize"/>
+/// tokens, drops the rest, and continues from a fresh cache seeded with the kept turns.
+/// </remarks>
+public sealed class CacheEvictionConfig
+{
+    /// <summary>
+    /// Initializes a new instance of the CacheEvictionConfig class
+    /// </summary>
+    /// <param name="startSize">Tokens kept from the start of the conversation</param>
+    /// <param name="recentSize">Tokens kept from the end of the conversation</param>
+    /// <param name="maxCacheSize">Tokens the cache may hold before eviction</param>
+    public CacheEvictionConfig(int startSize, int recentSize, int maxCacheSize)
+    {
+        if (startSize < 0)
+            throw new ArgumentOutOfRangeException(nameof(startSize), "Start size cannot be negative");
+        if (recentSize < 0)
+            throw new ArgumentOutOfRangeException(nameof(recentSize), "Recent size cannot be negative");
+        if (maxCacheSize <= 0)
+            throw new ArgumentOutOfRangeException(nameof(maxCacheSize), "Max cache size must be positive");
+        if (startSize + recentSize >= maxCacheSize)
+            throw new ArgumentException("Start and recent sizes must leave room below the max cache size", nameof(maxCacheSize));
+
+        StartSize = startSize;
+        RecentSize = recentSize;
+        MaxCacheSize = maxCacheSize;
+    }
+
+    /// <summary>
+    /// Gets the number of tokens kept from the start of the conversation
+    /// </summary>
+    public int StartSize { get; }
+
+    /// <summary>
+    /// Gets the number of tokens kept from the end of the conversation
+    /// </summary>
+    public int RecentSize { get; }
+
+    /// <summary>
+    /// Gets the number of tokens the cache may hold before eviction
+    /// </summary>
+    public int MaxCacheSize { get; }
+}
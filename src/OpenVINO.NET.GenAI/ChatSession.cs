@@ -1,3 +1,6 @@
+using System.Runtime.CompilerServices;
+using System.Text;
+
 namespace Fluid.OpenVINO.GenAI;
 
 /// <summary>
@@ -6,6 +9,10 @@ namespace Fluid.OpenVINO.GenAI;
 public sealed class ChatSession : IDisposable
 {
     private readonly LLMPipeline _pipeline;
+    private readonly CacheEvictionConfig? _evictionConfig;
+    private List<ChatTurn> _turns = new();
+    private int _cachedTokens;
+    private int _compactions;
     private bool _disposed;
     private bool _sessionStarted;
 
@@ -13,13 +20,35 @@ public sealed class ChatSession : IDisposable
     /// Initializes a new instance of the ChatSession class
     /// </summary>
     /// <param name="pipeline">The LLM pipeline to use</param>
-    internal ChatSession(LLMPipeline pipeline)
+    /// <param name="evictionConfig">Bounds the KV cache of the session (optional)</param>
+    internal ChatSession(LLMPipeline pipeline, CacheEvictionConfig? evictionConfig = null)
     {
         _pipeline = pipeline;
+        _evictionConfig = evictionConfig;
         _pipeline.StartChat();
         _sessionStarted = true;
     }
 
+    /// <summary>
+    /// Gets the eviction config, or null if the cache grows with the conversation
+    /// </summary>
+    public CacheEvictionConfig? EvictionConfig => _evictionConfig;
+
+    /// <summary>
+    /// Gets the estimated number of tokens held in the KV cache
+    /// </summary>
+    public int CachedTokens => _cachedTokens;
+
+    /// <summary>
+    /// Gets the fraction of <see cref="CacheEvictionConfig.MaxCacheSize"/> in use, or null without an eviction config
+    /// </summary>
+    public double? CacheUtilization => _evictionConfig != null ? (double)_cachedTokens / _evictionConfig.MaxCacheSize : null;
+
+    /// <summary>
+    /// Gets the number of times the conversation was compacted to stay within the cache budget
+    /// </summary>
+    public int Compactions => _compactions;
+
     /// <summary>
     /// Sends a message and gets a response
     /// </summary>
@@ -29,7 +58,9 @@ public sealed class ChatSession : IDisposable
     public GenerationResult SendMessage(string message, GenerationConfig? config = null)
     {
         ThrowIfDisposed();
-        return _pipeline.Generate(message, config);
+        var result = _pipeline.Generate(PrepareMessage(message, out var contextTokens), config);
+        RecordTurn(message, result, contextTokens);
+        return result;
     }
 
     /// <summary>
@@ -45,7 +76,9 @@ public sealed class ChatSession : IDisposable
         CancellationToken cancellationToken = default)
     {
         ThrowIfDisposed();
-        return await _pipeline.GenerateAsync(message, config, cancellationToken);
+        var result = await _pipeline.GenerateAsync(PrepareMessage(message, out var contextTokens), config, cancellationToken);
+        RecordTurn(message, result, contextTokens);
+        return result;
     }
 
     /// <summary>
@@ -55,15 +88,111 @@ public sealed class ChatSession : IDisposable
     /// <param name="config">Generation configuration (optional)</param>
     /// <param name="cancellationToken">Cancellation token</param>
     /// <returns>An async enumerable of response tokens</returns>
-    public IAsyncEnumerable<string> SendMessageStreamAsync(
+    public async IAsyncEnumerable<string> SendMessageStreamAsync(
         string message,
         GenerationConfig? config = null,
-        CancellationToken cancellationToken = default)
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
     {
         ThrowIfDisposed();
-        return _pipeline.GenerateStreamAsync(message, config, cancellationToken);
+        var prompt = PrepareMessage(message, out var contextTokens);
+        var stream = _pipeline.GenerateStreamAsync(prompt, config, new GenerationOptions(), cancellationToken);
+        var response = new StringBuilder();
+        var completed = false;
+
+        try
+        {
+            await foreach (var token in stream)
+            {
+                response.Append(token);
+                yield return token;
+            }
+            completed = true;
+        }
+        finally
+        {
+            // A stopped stream has no metrics, but the native history still holds what was decoded
+            var tokens = completed
+                ? stream.InputTokens + stream.GeneratedTokens
+                : EstimateTokens(prompt) + EstimateTokens(response.ToString());
+            RecordTurn(message, response.ToString(), Math.Max(0, tokens - contextTokens));
+        }
     }
 
+    /// <summary>
+    /// Compacts the conversation if the message would overflow the cache budget, and returns the prompt to send
+    /// </summary>
+    /// <param name="message">The user's message</param>
+    /// <param name="contextTokens">Tokens of the kept turns replayed in the prompt, already counted by those turns</param>
+    private string PrepareMessage(string message, out int contextTokens)
+    {
+        contextTokens = 0;
+        if (_evictionConfig == null || _cachedTokens + EstimateTokens(message) <= _evictionConfig.MaxCacheSize)
+            return message;
+
+        // The native chat history cannot be edited, so restart it and replay the kept turns as context
+        _pipeline.FinishChat();
+        _pipeline.StartChat();
+        _turns = SelectKeptTurns(_turns, _evictionConfig);
+        contextTokens = _turns.Sum(turn => turn.Tokens);
+        _cachedTokens = contextTokens;
+        _compactions++;
+
+        if (_turns.Count == 0)
+            return message;
+
+        var builder = new StringBuilder("Earlier in this conversation:\n");
+        foreach (var turn in _turns)
+        {
+            builder.Append("User: ").Append(turn.User).Append('\n');
+            builder.Append("Assistant: ").Append(turn.Assistant).Append('\n');
+        }
+        builder.Append('\n').Append(message);
+        return builder.ToString();
+    }
+
+    private void RecordTurn(string message, GenerationResult result, int contextTokens)
+    {
+        // The replayed context is counted once, by the turns it came from
+        var metrics = result.PerformanceMetrics;
+        RecordTurn(message, result.Text, Math.Max(0, metrics.NumInputTokens + metrics.NumGenerationTokens - contextTokens));
+    }
+
+    private void RecordTurn(string message, string response, int tokens)
+    {
+        _cachedTokens += tokens;
+        if (_evictionConfig != null)
+        {
+            _turns.Add(new ChatTurn(message, response, tokens));
+        }
+    }
+
+    /// <summary>
+    /// Keeps the first turns that fit in the start budget and the last turns that fit in the recent budget
+    /// </summary>
+    internal static List<ChatTurn> SelectKeptTurns(List<ChatTurn> turns, CacheEvictionConfig config)
+    {
+        var startCount = 0;
+        for (int tokens = 0; startCount < turns.Count && tokens + turns[startCount].Tokens <= config.StartSize; startCount++)
+        {
+            tokens += turns[startCount].Tokens;
+        }
+
+        var recentStart = turns.Count;
+        for (int tokens = 0; recentStart > startCount && tokens + turns[recentStart - 1].Tokens <= config.RecentSize; recentStart--)
+        {
+            tokens += turns[recentStart - 1].Tokens;
+        }
+
+        var kept = turns.GetRange(0, startCount);
+        kept.AddRange(turns.GetRange(recentStart, turns.Count - recentStart));
+        return kept;
+    }
+
+    /// <summary>
+    /// Roughly estimates the token count of text when the tokenizer's count is unavailable
+    /// </summary>
+    private static int EstimateTokens(string text) => (text.Length + 3) / 4;
+
     /// <summary>
     /// Releases all resources used by the ChatSession
     /// </summary>
@@ -111,4 +240,23 @@ public static class LLMPipelineExtensions
     {
         return new ChatSession(pipeline);
     }
+
+    /// <summary>
+    /// Starts a new chat session whose KV cache is bounded by evicting the middle of the conversation
+    /// </summary>
+    /// <param name="pipeline">The LLM pipeline</param>
+    /// <param name="evictionConfig">Cache budget and the parts of the conversation to keep</param>
+    /// <returns>A new chat session</returns>
+    public static ChatSession StartChatSession(this LLMPipeline pipeline, CacheEvictionConfig evictionConfig)
+    {
+        if (evictionConfig == null)
+            throw new ArgumentNullException(nameof(evictionConfig));
+
+        return new ChatSession(pipeline, evictionConfig);
+    }
 }
+
+/// <summary>
+/// A completed exchange of a chat session and its estimated cache footprint
+/// </summary>
+internal sealed record ChatTurn(string User, string Assistant, int Tokens);
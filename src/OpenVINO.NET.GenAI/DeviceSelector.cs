@@ -0,0 +1,529 @@
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using Fluid.OpenVINO.GenAI.Exceptions;
+using Fluid.OpenVINO.GenAI.Logging;
+using Fluid.OpenVINO.GenAI.Native;
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Chooses the device and inference precision for a model by benchmarking the candidates available on the host
+/// </summary>
+/// <remarks>
+/// Each candidate compiles the model, runs a short synthetic workload shaped like the
+/// <see cref="WorkloadProfile"/> and is ranked by <see cref="WorkloadProfile.EstimateLatency"/>.
+/// The winner is stored in a JSON file keyed by a fingerprint of the model files, the host
+/// hardware and the profile, so later calls return immediately until one of them changes.
+/// INT8 execution is not a runtime precision hint: it comes from weight compression at export
+/// time and is measured automatically when the model itself is INT8.
+/// </remarks>
+public sealed class DeviceSelector
+{
+    private readonly TuningStore<StoredSelection> _store;
+    private readonly ILogger _logger;
+
+    /// <summary>
+    /// Initializes a new instance of the DeviceSelector class
+    /// </summary>
+    /// <param name="cacheFilePath">File where selections are stored, or null for <see cref="DefaultCacheFilePath"/></param>
+    public DeviceSelector(string? cacheFilePath = null)
+    {
+        _logger = GenAILogging.CreateLogger<DeviceSelector>();
+        _store = new TuningStore<StoredSelection>(cacheFilePath ?? DefaultCacheFilePath, _logger);
+    }
+
+    /// <summary>
+    /// Gets the default location of the selection file, under the user's local application data
+    /// </summary>
+    public static string DefaultCacheFilePath => TuningStore<StoredSelection>.GetDefaultPath("device-selection.json");
+
+    /// <summary>
+    /// Gets the file where selections are stored
+    /// </summary>
+    public string CacheFilePath => _store.Path;
+
+    /// <summary>
+    /// Gets or sets the number of measured runs per candidate, after one warm-up run
+    /// </summary>
+    public int Iterations { get; set; } = 2;
+
+    /// <summary>
+    /// Selects the fastest device and precision for a model, benchmarking only when no stored selection matches
+    /// </summary>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="profile">Expected workload, or null for <see cref="WorkloadProfile.Chat"/></param>
+    /// <param name="refresh">True to benchmark again even if a stored selection matches</param>
+    /// <param name="cancellationToken">Cancellation token checked between candidates</param>
+    /// <returns>The selection</returns>
+    public async Task<DeviceSelection> SelectAsync(
+        string modelPath,
+        WorkloadProfile? profile = null,
+        bool refresh = false,
+        CancellationToken cancellationToken = default)
+    {
+        if (string.IsNullOrEmpty(modelPath))
+            throw new ArgumentException("Model path cannot be null or empty", nameof(modelPath));
+        if (!Directory.Exists(modelPath))
+            throw new DirectoryNotFoundException($"Model directory not found: {modelPath}");
+        if (Iterations <= 0)
+            throw new InvalidOperationException("Iterations must be positive");
+
+        profile ??= WorkloadProfile.Chat;
+
+        var devices = GetAvailableDevices();
+        var key = ComputeKey(modelPath, devices, profile);
+
+        if (!refresh)
+        {
+            var stored = await _store.ReadAsync(key, cancellationToken).ConfigureAwait(false);
+            if (stored != null)
+            {
+                var cached = new DeviceSelection(
+                    new DeviceCandidate(stored.Device, stored.Precision),
+                    stored.TimeToFirstTokenMs,
+                    stored.TimePerOutputTokenMs,
+                    fromCache: true,
+                    Array.Empty<DeviceBenchmarkResult>());
+                Log.DeviceSelected(_logger, cached.ToString(), modelPath, true);
+                return cached;
+            }
+        }
+
+        var results = new List<DeviceBenchmarkResult>();
+        foreach (var candidate in GetCandidates(devices))
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+            var result = await LLMBenchmark.RunCandidateAsync(() => Benchmark(modelPath, candidate, profile), cancellationToken).ConfigureAwait(false);
+            results.Add(result);
+        }
+
+        var best = SelectBest(results, modelPath);
+        var selection = new DeviceSelection(
+            best.Candidate,
+            best.TimeToFirstTokenMs,
+            best.TimePerOutputTokenMs,
+            fromCache: false,
+            results);
+
+        await _store.WriteAsync(key, new StoredSelection
+        {
+            Device = best.Candidate.Device,
+            Precision = best.Candidate.Precision,
+            TimeToFirstTokenMs = best.TimeToFirstTokenMs,
+            TimePerOutputTokenMs = best.TimePerOutputTokenMs,
+            MeasuredAt = DateTimeOffset.UtcNow
+        }, cancellationToken).ConfigureAwait(false);
+
+        Log.DeviceSelected(_logger, selection.ToString(), modelPath, false);
+        return selection;
+    }
+
+    /// <summary>
+    /// Removes all stored selections
+    /// </summary>
+    public void ClearCache() => _store.Clear();
+
+    /// <summary>
+    /// Queries the OpenVINO runtime for the devices available on this host
+    /// </summary>
+    /// <returns>The available devices</returns>
+    public static IReadOnlyList<DeviceInfo> GetAvailableDevices()
+    {
+        NativeLibraryLoader.EnsureLoaded();
+
+        var status = CoreNativeMethods.ov_core_create(out var core);
+        OpenVINOGenAIException.ThrowIfError(status, "create OpenVINO core");
+
+        try
+        {
+            status = CoreNativeMethods.ov_core_get_available_devices(core, out var list);
+            OpenVINOGenAIException.ThrowIfError(status, "get available devices");
+
+            try
+            {
+                var devices = new List<DeviceInfo>((int)list.size);
+                for (int i = 0; i < (int)list.size; i++)
+                {
+                    var name = Marshal.PtrToStringAnsi(Marshal.ReadIntPtr(list.devices, i * IntPtr.Size));
+                    if (string.IsNullOrEmpty(name))
+                        continue;
+
+                    var fullName = GetDeviceProperty(core, name, "FULL_DEVICE_NAME") ?? name;
+                    var capabilities = GetDeviceProperty(core, name, "OPTIMIZATION_CAPABILITIES")?
+                        .Split(new[] { ' ', ',' }, StringSplitOptions.RemoveEmptyEntries) ?? Array.Empty<string>();
+                    devices.Add(new DeviceInfo(name, fullName, capabilities));
+                }
+
+                return devices;
+            }
+            finally
+            {
+                CoreNativeMethods.ov_available_devices_free(ref list);
+            }
+        }
+        finally
+        {
+            CoreNativeMethods.ov_core_free(core);
+        }
+    }
+
+    /// <summary>
+    /// Lists the device and precision combinations worth benchmarking on the given devices
+    /// </summary>
+    /// <remarks>
+    /// CPU is tried at FP32 and at each reduced precision it reports; the fastest differs between
+    /// CPU generations. Other devices use their plugin's default precision. AUTO is added when more
+    /// than one device is present, and HETERO when a GPU can offload to the CPU.
+    /// </remarks>
+    /// <param name="devices">Available devices</param>
+    /// <returns>The candidates</returns>
+    public static IReadOnlyList<DeviceCandidate> GetCandidates(IReadOnlyList<DeviceInfo> devices)
+    {
+        if (devices == null)
+            throw new ArgumentNullException(nameof(devices));
+
+        var candidates = new List<DeviceCandidate>();
+        string? firstGpu = null;
+        var hasCpu = false;
+
+        foreach (var device in devices)
+        {
+            if (device.Name == "CPU")
+            {
+                hasCpu = true;
+                candidates.Add(new DeviceCandidate("CPU", InferencePrecision.F32));
+                if (device.Supports("BF16"))
+                    candidates.Add(new DeviceCandidate("CPU", InferencePrecision.BF16));
+                if (device.Supports("FP16"))
+                    candidates.Add(new DeviceCandidate("CPU", InferencePrecision.F16));
+            }
+            else
+            {
+                candidates.Add(new DeviceCandidate(device.Name, null));
+                if (firstGpu == null && device.Name.StartsWith("GPU", StringComparison.Ordinal))
+                    firstGpu = device.Name;
+            }
+        }
+
+        if (devices.Count > 1)
+            candidates.Add(new DeviceCandidate("AUTO", null));
+        if (firstGpu != null && hasCpu)
+            candidates.Add(new DeviceCandidate($"HETERO:{firstGpu},CPU", null));
+
+        return candidates;
+    }
+
+    /// <summary>
+    /// Picks the candidate with the lowest estimated latency
+    /// </summary>
+    /// <remarks>
+    /// A run that stopped after one token has no time per output token, so its estimate would
+    /// favour it unfairly. Such candidates are only ranked, by time to first token, when no
+    /// candidate generated more.
+    /// </remarks>
+    /// <exception cref="OpenVINOGenAIException">There were no candidates, or none could run the model</exception>
+    internal static DeviceBenchmarkResult SelectBest(IReadOnlyList<DeviceBenchmarkResult> results, string modelPath)
+    {
+        if (results.Count == 0)
+            throw new OpenVINOGenAIException(ov_status_e.GENERAL_ERROR, $"No device candidates to run the model at {modelPath}");
+
+        var succeeded = results.Where(r => r.Succeeded).ToList();
+        if (succeeded.Count == 0)
+            throw new OpenVINOGenAIException(
+                ov_status_e.GENERAL_ERROR,
+                $"No device could run the model at {modelPath}",
+                results.First().Error!);
+
+        var decoded = succeeded.Where(r => r.GeneratedTokens >= 2).ToList();
+        return decoded.Count > 0
+            ? decoded.OrderBy(r => r.EstimatedLatencyMs).First()
+            : succeeded.OrderBy(r => r.TimeToFirstTokenMs).First();
+    }
+
+    private DeviceBenchmarkResult Benchmark(string modelPath, DeviceCandidate candidate, WorkloadProfile profile)
+    {
+        try
+        {
+            var stopwatch = Stopwatch.StartNew();
+            using var pipeline = new LLMPipeline(modelPath, candidate.Device, candidate.CreateProperties());
+            var loadTime = stopwatch.Elapsed;
+
+            var (ttft, tpot, generated) = LLMBenchmark.MeasureLatency(pipeline, profile, Iterations);
+
+            var benchmark = new DeviceBenchmarkResult(candidate, ttft, tpot, profile.EstimateLatency(ttft, tpot), generated, loadTime, null);
+            Log.DeviceBenchmarked(_logger, candidate.ToString(), ttft, tpot);
+            return benchmark;
+        }
+        catch (Exception ex)
+        {
+            // A device that cannot compile or run the model, for whatever reason, is reported and
+            // skipped; the remaining candidates are still measured
+            Log.DeviceBenchmarkFailed(_logger, candidate.ToString(), ex);
+            return new DeviceBenchmarkResult(candidate, double.NaN, double.NaN, double.NaN, 0, TimeSpan.Zero, ex);
+        }
+    }
+
+    private static string? GetDeviceProperty(IntPtr core, string device, string key)
+    {
+        var status = CoreNativeMethods.ov_core_get_property(core, device, key, out var value);
+        if (status != ov_status_e.OK || value == IntPtr.Zero)
+            return null;
+
+        try
+        {
+            return Marshal.PtrToStringAnsi(value);
+        }
+        finally
+        {
+            CoreNativeMethods.ov_free(value);
+        }
+    }
+
+    /// <summary>
+    /// Computes the key of a selection from the model files, the host hardware and the profile
+    /// </summary>
+    private static string ComputeKey(string modelPath, IReadOnlyList<DeviceInfo> devices, WorkloadProfile profile)
+    {
+        var key = new TuningKey(modelPath);
+        foreach (var device in devices)
+        {
+            key.Add("device", $"{device.Name}:{device.FullName}");
+        }
+
+        return key.Add("profile", $"{profile.Name}:{profile.PromptWords}:{profile.OutputTokens}").ToString();
+    }
+
+    private sealed class StoredSelection
+    {
+        public string Device { get; set; } = string.Empty;
+
+        public InferencePrecision? Precision { get; set; }
+
+        public double TimeToFirstTokenMs { get; set; }
+
+        public double TimePerOutputTokenMs { get; set; }
+
+        public DateTimeOffset MeasuredAt { get; set; }
+    }
+}
+
+/// <summary>
+/// An inference device reported by the OpenVINO runtime
+/// </summary>
+public sealed class DeviceInfo
+{
+    /// <summary>
+    /// Initializes a new instance of the DeviceInfo class
+    /// </summary>
+    /// <param name="name">Device name passed to pipelines (e.g., "CPU", "GPU.0")</param>
+    /// <param name="fullName">Human-readable device name</param>
+    /// <param name="capabilities">Optimization capabilities (e.g., "FP32", "BF16", "INT8")</param>
+    public DeviceInfo(string name, string fullName, IEnumerable<string> capabilities)
+    {
+        Name = name ?? throw new ArgumentNullException(nameof(name));
+        FullName = fullName ?? name;
+        Capabilities = capabilities?.ToArray() ?? Array.Empty<string>();
+    }
+
+    /// <summary>
+    /// Gets the device name passed to pipelines
+    /// </summary>
+    public string Name { get; }
+
+    /// <summary>
+    /// Gets the human-readable device name
+    /// </summary>
+    public string FullName { get; }
+
+    /// <summary>
+    /// Gets the optimization capabilities reported by the device
+    /// </summary>
+    public IReadOnlyList<string> Capabilities { get; }
+
+    /// <summary>
+    /// Gets whether the device reports a capability
+    /// </summary>
+    /// <param name="capability">Capability name (e.g., "BF16")</param>
+    public bool Supports(string capability) => Capabilities.Contains(capability, StringComparer.OrdinalIgnoreCase);
+
+    /// <inheritdoc/>
+    public override string ToString() => $"{Name} ({FullName})";
+}
+
+/// <summary>
+/// A device and optional inference precision to benchmark
+/// </summary>
+public sealed class DeviceCandidate
+{
+    /// <summary>
+    /// Initializes a new instance of the DeviceCandidate class
+    /// </summary>
+    /// <param name="device">Device string passed to pipelines</param>
+    /// <param name="precision">Inference precision hint, or null for the device default</param>
+    public DeviceCandidate(string device, InferencePrecision? precision)
+    {
+        Device = device ?? throw new ArgumentNullException(nameof(device));
+        Precision = precision;
+    }
+
+    /// <summary>
+    /// Gets the device string passed to pipelines
+    /// </summary>
+    public string Device { get; }
+
+    /// <summary>
+    /// Gets the inference precision hint, or null for the device default
+    /// </summary>
+    public InferencePrecision? Precision { get; }
+
+    /// <summary>
+    /// Creates pipeline properties that apply this candidate's precision
+    /// </summary>
+    /// <returns>The properties</returns>
+    public PipelineProperties CreateProperties()
+    {
+        var properties = new PipelineProperties();
+        if (Precision.HasValue)
+            properties.WithInferencePrecision(Precision.Value);
+        return properties;
+    }
+
+    /// <inheritdoc/>
+    public override string ToString() => Precision.HasValue ? $"{Device} ({Precision.Value})" : Device;
+}
+
+/// <summary>
+/// Benchmark measurements of one candidate
+/// </summary>
+public sealed class DeviceBenchmarkResult
+{
+    internal DeviceBenchmarkResult(
+        DeviceCandidate candidate,
+        double timeToFirstTokenMs,
+        double timePerOutputTokenMs,
+        double estimatedLatencyMs,
+        int generatedTokens,
+        TimeSpan loadTime,
+        Exception? error)
+    {
+        Candidate = candidate;
+        TimeToFirstTokenMs = timeToFirstTokenMs;
+        TimePerOutputTokenMs = timePerOutputTokenMs;
+        EstimatedLatencyMs = estimatedLatencyMs;
+        GeneratedTokens = generatedTokens;
+        LoadTime = loadTime;
+        Error = error;
+    }
+
+    /// <summary>
+    /// Gets the benchmarked candidate
+    /// </summary>
+    public DeviceCandidate Candidate { get; }
+
+    /// <summary>
+    /// Gets the mean time to first token in milliseconds
+    /// </summary>
+    public double TimeToFirstTokenMs { get; }
+
+    /// <summary>
+    /// Gets the mean time per output token in milliseconds
+    /// </summary>
+    public double TimePerOutputTokenMs { get; }
+
+    /// <summary>
+    /// Gets the estimated latency of one request of the workload profile in milliseconds
+    /// </summary>
+    public double EstimatedLatencyMs { get; }
+
+    /// <summary>
+    /// Gets the fewest tokens generated by a measured run; below 2 the time per output token is not measured
+    /// </summary>
+    public int GeneratedTokens { get; }
+
+    /// <summary>
+    /// Gets the time taken to load and compile the model
+    /// </summary>
+    public TimeSpan LoadTime { get; }
+
+    /// <summary>
+    /// Gets the error that prevented the candidate from running, if any
+    /// </summary>
+    public Exception? Error { get; }
+
+    /// <summary>
+    /// Gets whether the candidate ran the workload
+    /// </summary>
+    public bool Succeeded => Error == null;
+}
+
+/// <summary>
+/// The device and precision chosen for a model
+/// </summary>
+public sealed class DeviceSelection
+{
+    internal DeviceSelection(
+        DeviceCandidate candidate,
+        double timeToFirstTokenMs,
+        double timePerOutputTokenMs,
+        bool fromCache,
+        IReadOnlyList<DeviceBenchmarkResult> results)
+    {
+        Candidate = candidate;
+        TimeToFirstTokenMs = timeToFirstTokenMs;
+        TimePerOutputTokenMs = timePerOutputTokenMs;
+        FromCache = fromCache;
+        Results = results;
+    }
+
+    /// <summary>
+    /// Gets the chosen candidate
+    /// </summary>
+    public DeviceCandidate Candidate { get; }
+
+    /// <summary>
+    /// Gets the device string to pass to pipelines
+    /// </summary>
+    public string Device => Candidate.Device;
+
+    /// <summary>
+    /// Gets the chosen inference precision, or null for the device default
+    /// </summary>
+    public InferencePrecision? Precision => Candidate.Precision;
+
+    /// <summary>
+    /// Gets the measured time to first token in milliseconds
+    /// </summary>
+    public double TimeToFirstTokenMs { get; }
+
+    /// <summary>
+    /// Gets the measured time per output token in milliseconds
+    /// </summary>
+    public double TimePerOutputTokenMs { get; }
+
+    /// <summary>
+    /// Gets whether the selection was read from the selection file instead of measured
+    /// </summary>
+    public bool FromCache { get; }
+
+    /// <summary>
+    /// Gets the measurements of every candidate; empty when <see cref="FromCache"/> is true
+    /// </summary>
+    public IReadOnlyList<DeviceBenchmarkResult> Results { get; }
+
+    /// <summary>
+    /// Creates pipeline properties that apply the chosen precision
+    /// </summary>
+    /// <returns>The properties</returns>
+    public PipelineProperties CreateProperties() => Candidate.CreateProperties();
+
+    /// <summary>
+    /// Creates an LLM pipeline on the chosen device
+    /// </summary>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <returns>The pipeline</returns>
+    public LLMPipeline CreatePipeline(string modelPath) => new(modelPath, Device, CreateProperties());
+
+    /// <inheritdoc/>
+    public override string ToString() => Candidate.ToString();
+}
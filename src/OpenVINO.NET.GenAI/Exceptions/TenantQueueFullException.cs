@@ -0,0 +1,24 @@
+using Fluid.OpenVINO.GenAI.Native;
+
+namespace Fluid.OpenVINO.GenAI.Exceptions;
+
+/// <summary>
+/// Exception thrown when a tenant already has the maximum number of requests waiting
+/// </summary>
+public class TenantQueueFullException : OpenVINOGenAIException
+{
+    /// <summary>
+    /// Gets the tenant whose request was rejected
+    /// </summary>
+    public string TenantId { get; }
+
+    /// <summary>
+    /// Initializes a new instance of the TenantQueueFullException class
+    /// </summary>
+    /// <param name="tenantId">The tenant whose request was rejected</param>
+    public TenantQueueFullException(string tenantId)
+        : base(ov_status_e.REQUEST_BUSY, $"Too many requests are waiting for tenant '{tenantId}'")
+    {
+        TenantId = tenantId;
+    }
+}
@@ -52,9 +52,9 @@ public sealed class GenerationConfig : IDisposable
     }
 
     /// <summary>
-    /// Gets the native handle
+    /// Gets the native handle; native calls hold a <see cref="HandleReference"/> on it
     /// </summary>
-    internal IntPtr Handle => _handle.DangerousGetHandle();
+    internal GenerationConfigSafeHandle Handle => _handle;
 
     /// <summary>
     /// Gets the default generation configuration
@@ -220,14 +220,14 @@ public sealed class GenerationConfig : IDisposable
     /// <summary>
     /// Gets the maximum number of new tokens
     /// </summary>
-    /// <returns>The maximum number of new tokens</returns>
+    /// <returns>The maximum number of new tokens; <see cref="int.MaxValue"/> when unlimited, the native default</returns>
     public int GetMaxNewTokens()
     {
         ThrowIfDisposed();
 
         var status = GenAINativeMethods.ov_genai_generation_config_get_max_new_tokens(_handle.DangerousGetHandle(), out var maxNewTokens);
         OpenVINOGenAIException.ThrowIfError(status, "get max new tokens");
-        return (int)maxNewTokens;
+        return (int)Math.Min(maxNewTokens, (nuint)int.MaxValue);
     }
 
     /// <summary>
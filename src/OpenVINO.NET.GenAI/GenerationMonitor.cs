@@ -0,0 +1,215 @@
+using System.Diagnostics;
+using System.Text;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Smoothed time to first token and time per output token of a pipeline, measured from
+/// streamed generations
+/// </summary>
+internal sealed class LatencyTracker
+{
+    // Weight of the newest measurement; recent load matters more than the pipeline's history
+    private const double Smoothing = 0.3;
+
+    private readonly object _lock = new();
+    private double? _timeToFirstTokenMs;
+    private double? _timePerOutputTokenMs;
+
+    public void Record(double timeToFirstTokenMs, double? timePerOutputTokenMs)
+    {
+        lock (_lock)
+        {
+            _timeToFirstTokenMs = Smooth(_timeToFirstTokenMs, timeToFirstTokenMs);
+            if (timePerOutputTokenMs.HasValue)
+                _timePerOutputTokenMs = Smooth(_timePerOutputTokenMs, timePerOutputTokenMs.Value);
+        }
+    }
+
+    public bool TryGetEstimate(out double timeToFirstTokenMs, out double timePerOutputTokenMs)
+    {
+        lock (_lock)
+        {
+            timeToFirstTokenMs = _timeToFirstTokenMs ?? 0;
+            timePerOutputTokenMs = _timePerOutputTokenMs ?? 0;
+            return _timeToFirstTokenMs.HasValue && _timePerOutputTokenMs.HasValue;
+        }
+    }
+
+    private static double Smooth(double? current, double value)
+        => current.HasValue ? current.Value + Smoothing * (value - current.Value) : value;
+}
+
+/// <summary>
+/// Watches one generation from the streaming callback: measures token timings for the
+/// pipeline's <see cref="LatencyTracker"/> and decides when to stop for the request's deadline
+/// and stop conditions
+/// </summary>
+/// <remarks>
+/// The deadline counts from the call, including the wait for the pipeline, while the timings fed
+/// to the tracker count from <see cref="Begin"/>, so queueing under load does not inflate the
+/// pipeline's measured time to first token.
+/// </remarks>
+internal sealed class GenerationMonitor
+{
+    private readonly LatencyTracker _tracker;
+    private readonly IReadOnlyList<StopPredicate> _stopConditions;
+    private readonly IReadOnlyList<string> _stopSequences;
+    private readonly int _longestStopSequence;
+    private readonly long _start;
+    private readonly long? _deadline;
+    private double _fallbackTicksPerToken;
+    private long _began;
+    private long _firstToken;
+    private long _lastToken;
+    private int _tokens;
+    private char[] _text = Array.Empty<char>();
+    private int _length;
+
+    public GenerationMonitor(GenerationOptions? options, LatencyTracker tracker)
+    {
+        _tracker = tracker;
+        _start = Stopwatch.GetTimestamp();
+        _began = _start;
+        _stopConditions = options?.StopConditions.ToArray() ?? Array.Empty<StopPredicate>();
+        _stopSequences = options?.StopSequences.ToArray() ?? Array.Empty<string>();
+        _longestStopSequence = _stopSequences.Count > 0 ? _stopSequences.Max(s => s.Length) : 0;
+
+        if (options?.Deadline is { } budget)
+            _deadline = _start + (long)(budget.TotalSeconds * Stopwatch.Frequency);
+    }
+
+    /// <summary>
+    /// Gets the number of tokens planned to fit the deadline, or null if there is no deadline,
+    /// no measurement yet or the generation has not begun
+    /// </summary>
+    public int? TokenLimit { get; private set; }
+
+    /// <summary>
+    /// Gets the number of streamed tokens
+    /// </summary>
+    public int Tokens => _tokens;
+
+    /// <summary>
+    /// Gets the time since the generation was requested
+    /// </summary>
+    public TimeSpan Elapsed => TimeSpan.FromSeconds((double)(Stopwatch.GetTimestamp() - _start) / Stopwatch.Frequency);
+
+    /// <summary>
+    /// Gets whether decoding was stopped for the deadline
+    /// </summary>
+    public bool IsTruncatedByDeadline { get; private set; }
+
+    /// <summary>
+    /// Gets whether decoding was stopped by a stop condition or sequence
+    /// </summary>
+    public bool IsStoppedByCondition { get; private set; }
+
+    /// <summary>
+    /// Marks the moment the pipeline starts the generation, after any wait for it, and plans the
+    /// tokens that fit the rest of the deadline
+    /// </summary>
+    public void Begin()
+    {
+        _began = Stopwatch.GetTimestamp();
+        if (!_deadline.HasValue || !_tracker.TryGetEstimate(out var timeToFirstTokenMs, out var timePerOutputTokenMs) || timePerOutputTokenMs <= 0)
+            return;
+
+        // The first token arrives after TTFT, each further one after TPOT
+        var remainingMs = (double)(_deadline.Value - _began) * 1000 / Stopwatch.Frequency;
+        var fitting = (remainingMs - timeToFirstTokenMs) / timePerOutputTokenMs;
+        TokenLimit = Math.Max(1, (int)Math.Min(int.MaxValue - 1, fitting) + 1);
+        _fallbackTicksPerToken = timePerOutputTokenMs * Stopwatch.Frequency / 1000;
+    }
+
+    /// <summary>
+    /// Records a streamed token
+    /// </summary>
+    /// <param name="utf8">UTF-8 text of the token</param>
+    /// <returns>True if decoding must stop</returns>
+    public bool OnToken(ReadOnlySpan<byte> utf8)
+    {
+        var now = Stopwatch.GetTimestamp();
+        if (_tokens++ == 0)
+            _firstToken = now;
+        _lastToken = now;
+
+        if (MatchesStopCondition(utf8))
+        {
+            IsStoppedByCondition = true;
+            return true;
+        }
+
+        if (!_deadline.HasValue)
+            return false;
+
+        if (_tokens >= TokenLimit)
+        {
+            IsTruncatedByDeadline = true;
+            return true;
+        }
+
+        // The request's own pace is the best predictor of the next token; until it has one, use the pipeline's
+        var ticksPerToken = _tokens > 1 ? (double)(now - _firstToken) / (_tokens - 1) : _fallbackTicksPerToken;
+        if (now + ticksPerToken > _deadline.Value)
+        {
+            IsTruncatedByDeadline = true;
+            return true;
+        }
+
+        return false;
+    }
+
+    private bool MatchesStopCondition(ReadOnlySpan<byte> utf8)
+    {
+        // Text is only decoded when something reads it
+        if (_stopConditions.Count == 0 && _stopSequences.Count == 0)
+            return false;
+
+        var appendedAt = _length;
+        Append(utf8);
+        var text = new ReadOnlySpan<char>(_text, 0, _length);
+
+        // A sequence completed by this token starts at most one character short of its length before it
+        if (_stopSequences.Count > 0)
+        {
+            var window = text.Slice(Math.Max(0, appendedAt - _longestStopSequence + 1));
+            foreach (var sequence in _stopSequences)
+            {
+                if (window.IndexOf(sequence.AsSpan(), StringComparison.Ordinal) >= 0)
+                    return true;
+            }
+        }
+
+        foreach (var condition in _stopConditions)
+        {
+            if (condition(text))
+                return true;
+        }
+
+        return false;
+    }
+
+    private void Append(ReadOnlySpan<byte> utf8)
+    {
+        var maxChars = Encoding.UTF8.GetMaxCharCount(utf8.Length);
+        if (_length + maxChars > _text.Length)
+            Array.Resize(ref _text, Math.Max(_length + maxChars, Math.Max(256, _text.Length * 2)));
+
+        _length += Encoding.UTF8.GetChars(utf8, _text.AsSpan(_length));
+    }
+
+    /// <summary>
+    /// Feeds the generation's timings to the pipeline's tracker
+    /// </summary>
+    public void Complete()
+    {
+        if (_tokens == 0)
+            return;
+
+        var frequency = (double)Stopwatch.Frequency;
+        _tracker.Record(
+            (_firstToken - _began) * 1000 / frequency,
+            _tokens > 1 ? (_lastToken - _firstToken) * 1000 / frequency / (_tokens - 1) : null);
+    }
+}
@@ -0,0 +1,148 @@
+using System.Text.RegularExpressions;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Decides from the text generated so far whether decoding should stop
+/// </summary>
+/// <param name="text">All text generated by the request so far</param>
+/// <returns>True to stop after the current token</returns>
+public delegate bool StopPredicate(ReadOnlySpan<char> text);
+
+/// <summary>
+/// Per-request options applied by the managed pipeline while tokens are streamed, rather than by
+/// the native <see cref="GenerationConfig"/>
+/// </summary>
+public sealed class GenerationOptions
+{
+    private readonly List<StopPredicate> _stopConditions = new();
+    private readonly List<string> _stopSequences = new();
+
+    /// <summary>
+    /// Gets the default <see cref="FlushInterval"/>
+    /// </summary>
+    public static TimeSpan DefaultFlushInterval { get; } = TimeSpan.FromMilliseconds(20);
+
+    /// <summary>
+    /// Default number of trailing characters a <see cref="StopWhen(Regex, int)"/> pattern is matched against
+    /// </summary>
+    public const int DefaultStopPatternWindow = 256;
+
+    /// <summary>
+    /// Gets the latency budget of the request, measured from the call, or null for none
+    /// </summary>
+    public TimeSpan? Deadline { get; private set; }
+
+    /// <summary>
+    /// Gets how long tokens written to a pipe or stream may wait to be flushed
+    /// </summary>
+    public TimeSpan FlushInterval { get; private set; } = DefaultFlushInterval;
+
+    /// <summary>
+    /// Gets the conditions added with <see cref="StopWhen(StopPredicate)"/> and <see cref="StopWhen(Regex, int)"/>
+    /// </summary>
+    internal IReadOnlyList<StopPredicate> StopConditions => _stopConditions;
+
+    /// <summary>
+    /// Gets the sequences added with <see cref="StopOn"/>
+    /// </summary>
+    internal IReadOnlyList<string> StopSequences => _stopSequences;
+
+    /// <summary>
+    /// Sets a latency budget: decoding stops with the tokens produced so far when the next
+    /// token would arrive after the budget, and the result is marked as truncated
+    /// </summary>
+    /// <remarks>
+    /// Once the pipeline has measured its time to first token and time per output token, the
+    /// number of tokens that fit the budget is also planned up front. A budget shorter than the
+    /// time to first token still produces one token.
+    /// </remarks>
+    /// <param name="budget">Time from the call until the last token must be produced</param>
+    /// <returns>These options for fluent chaining</returns>
+    public GenerationOptions WithDeadline(TimeSpan budget)
+    {
+        if (budget <= TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(budget), "Deadline must be positive");
+
+        Deadline = budget;
+        return this;
+    }
+
+    /// <summary>
+    /// Sets how long tokens written by GenerateToAsync may wait to be flushed: a token that
+    /// arrives sooner after the previous flush is sent with the next one
+    /// </summary>
+    /// <param name="interval">Longest time since the previous flush, or zero to flush every token</param>
+    /// <returns>These options for fluent chaining</returns>
+    public GenerationOptions WithFlushInterval(TimeSpan interval)
+    {
+        if (interval < TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(interval), "Flush interval cannot be negative");
+
+        FlushInterval = interval;
+        return this;
+    }
+
+    /// <summary>
+    /// Stops decoding right after the token for which the predicate returns true
+    /// </summary>
+    /// <remarks>
+    /// The predicate runs on the inference thread after every token, with all text generated
+    /// so far, so it should be cheap. Unlike <see cref="GenerationConfig.WithStopStrings"/>, the
+    /// text that triggered the stop is kept in the result.
+    /// </remarks>
+    /// <param name="predicate">Condition on the generated text</param>
+    /// <returns>These options for fluent chaining</returns>
+    public GenerationOptions StopWhen(StopPredicate predicate)
+    {
+        ArgumentNullException.ThrowIfNull(predicate);
+
+        _stopConditions.Add(predicate);
+        return this;
+    }
+
+    /// <summary>
+    /// Stops decoding right after the token that completes a match of the pattern
+    /// </summary>
+    /// <remarks>
+    /// Only the last <paramref name="window"/> characters of the generated text are matched, so
+    /// the cost per token does not grow with the length of the output. A match must fit in the
+    /// window, lookbehinds see no further back than its start, and <c>^</c> and <c>\A</c>
+    /// anchor to the window rather than to the start of the output.
+    /// </remarks>
+    /// <param name="pattern">Pattern matched against the end of the generated text</param>
+    /// <param name="window">Number of trailing characters matched</param>
+    /// <returns>These options for fluent chaining</returns>
+    public GenerationOptions StopWhen(Regex pattern, int window = DefaultStopPatternWindow)
+    {
+        ArgumentNullException.ThrowIfNull(pattern);
+        if (window <= 0)
+            throw new ArgumentOutOfRangeException(nameof(window), "Window must be positive");
+
+#if NET7_0_OR_GREATER
+        _stopConditions.Add(text => pattern.IsMatch(text.Slice(Math.Max(0, text.Length - window))));
+#else
+        _stopConditions.Add(text => pattern.IsMatch(text.Slice(Math.Max(0, text.Length - window)).ToString()));
+#endif
+        return this;
+    }
+
+    /// <summary>
+    /// Stops decoding right after the token that completes any of the sequences
+    /// </summary>
+    /// <remarks>
+    /// Only the newly generated text and the few characters before it are searched, so the
+    /// cost per token does not grow with the length of the output.
+    /// </remarks>
+    /// <param name="sequences">Literal sequences, such as a closing tag</param>
+    /// <returns>These options for fluent chaining</returns>
+    public GenerationOptions StopOn(params string[] sequences)
+    {
+        ArgumentNullException.ThrowIfNull(sequences);
+        if (sequences.Any(string.IsNullOrEmpty))
+            throw new ArgumentException("Stop sequences cannot be null or empty", nameof(sequences));
+
+        _stopSequences.AddRange(sequences);
+        return this;
+    }
+}
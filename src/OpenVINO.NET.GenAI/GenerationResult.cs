@@ -39,6 +39,16 @@ public sealed class GenerationResult : IDisposable
         }
     }
 
+    /// <summary>
+    /// Gets whether decoding was stopped early to meet the request's deadline
+    /// </summary>
+    public bool IsTruncatedByDeadline { get; internal init; }
+
+    /// <summary>
+    /// Gets whether decoding was stopped by one of the request's <see cref="GenerationOptions"/> stop conditions
+    /// </summary>
+    public bool IsStoppedByCondition { get; internal init; }
+
     /// <summary>
     /// Gets the performance metrics for this generation
     /// </summary>
@@ -0,0 +1,42 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// A stream of generated tokens that reports, once enumerated, why generation ended
+/// </summary>
+public sealed class GenerationStream : IAsyncEnumerable<string>
+{
+    private readonly Func<GenerationStream, CancellationToken, IAsyncEnumerable<string>> _source;
+
+    internal GenerationStream(Func<GenerationStream, CancellationToken, IAsyncEnumerable<string>> source)
+    {
+        _source = source;
+    }
+
+    /// <summary>
+    /// Gets whether decoding was stopped early to meet the request's deadline; valid after enumeration
+    /// </summary>
+    public bool IsTruncatedByDeadline { get; internal set; }
+
+    /// <summary>
+    /// Gets whether decoding was stopped by one of the request's stop conditions; valid after enumeration
+    /// </summary>
+    public bool IsStoppedByCondition { get; internal set; }
+
+    /// <summary>
+    /// Gets the number of prompt tokens, from the generation's performance metrics; valid after enumeration
+    /// </summary>
+    public int InputTokens { get; internal set; }
+
+    /// <summary>
+    /// Gets the number of generated tokens, from the generation's performance metrics; valid after enumeration
+    /// </summary>
+    /// <remarks>
+    /// Unlike the number of enumerated strings, this counts every decoded token, including
+    /// ones the detokenizer held back or merged into a single callback.
+    /// </remarks>
+    public int GeneratedTokens { get; internal set; }
+
+    /// <inheritdoc/>
+    public IAsyncEnumerator<string> GetAsyncEnumerator(CancellationToken cancellationToken = default)
+        => _source(this, cancellationToken).GetAsyncEnumerator(cancellationToken);
+}
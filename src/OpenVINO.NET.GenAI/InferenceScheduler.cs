@@ -0,0 +1,197 @@
+using System.Collections.Concurrent;
+using System.Diagnostics;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Runs blocking inference calls on a fixed set of dedicated threads instead of the thread pool
+/// </summary>
+/// <remarks>
+/// A generation blocks its thread for seconds. On the thread pool that starves request handling
+/// and timers, and the pool's slow thread injection then delays everything else. Each pipeline
+/// runs its async APIs on its own single-thread scheduler by default; share one scheduler between
+/// pipelines to bound the number of inference threads, or set a pipeline's scheduler to
+/// <see cref="TaskScheduler.Default"/> to use the thread pool.
+/// </remarks>
+public sealed class InferenceScheduler : TaskScheduler, IDisposable
+{
+    [ThreadStatic]
+    private static InferenceScheduler? _workerOf;
+
+    private readonly BlockingCollection<Task> _queue = new();
+    private readonly Thread[] _workers;
+    private readonly long _created;
+    private long _busyTicks;
+    private int _busyWorkers;
+
+    /// <summary>
+    /// Initializes a new instance of the InferenceScheduler class
+    /// </summary>
+    /// <param name="workerCount">Number of inference threads</param>
+    /// <param name="name">Thread name, shown in debuggers and profilers</param>
+    public InferenceScheduler(int workerCount = 1, string name = "OpenVINO inference")
+    {
+        if (workerCount <= 0)
+            throw new ArgumentOutOfRangeException(nameof(workerCount), "Worker count must be positive");
+
+        _created = Stopwatch.GetTimestamp();
+        _workers = new Thread[workerCount];
+        for (int i = 0; i < workerCount; i++)
+        {
+            // Background threads so an undisposed scheduler does not keep the process alive
+            _workers[i] = new Thread(Work)
+            {
+                IsBackground = true,
+                Name = workerCount == 1 ? name : $"{name} {i + 1}"
+            };
+            _workers[i].Start();
+        }
+    }
+
+    /// <summary>
+    /// Gets the number of inference threads
+    /// </summary>
+    public int WorkerCount => _workers.Length;
+
+    /// <summary>
+    /// Gets the number of threads currently running a call
+    /// </summary>
+    public int BusyWorkers => Volatile.Read(ref _busyWorkers);
+
+    /// <summary>
+    /// Gets the number of calls waiting for a thread
+    /// </summary>
+    public int QueuedCalls => _queue.Count;
+
+    /// <summary>
+    /// Gets the total time threads have spent running completed calls
+    /// </summary>
+    /// <remarks>
+    /// Sample it periodically to compute utilization over an interval.
+    /// </remarks>
+    public TimeSpan BusyTime => TimeSpan.FromSeconds((double)Interlocked.Read(ref _busyTicks) / Stopwatch.Frequency);
+
+    /// <summary>
+    /// Gets the fraction of thread time spent running calls since the scheduler was created, from 0 to 1
+    /// </summary>
+    public double Utilization
+    {
+        get
+        {
+            var elapsed = (double)(Stopwatch.GetTimestamp() - _created) * _workers.Length;
+            return elapsed > 0 ? Math.Min(1, Interlocked.Read(ref _busyTicks) / elapsed) : 0;
+        }
+    }
+
+    /// <inheritdoc/>
+    public override int MaximumConcurrencyLevel => _workers.Length;
+
+    /// <summary>
+    /// Stops the threads once queued calls have run; calls queued afterwards fail
+    /// </summary>
+    public void Dispose()
+    {
+        if (!_queue.IsAddingCompleted)
+        {
+            _queue.CompleteAdding();
+        }
+    }
+
+    /// <summary>
+    /// Gets a pipeline's scheduler, creating the pipeline's own single-thread scheduler on first use
+    /// </summary>
+    /// <param name="scheduler">The pipeline's scheduler field</param>
+    /// <param name="name">Thread name</param>
+    /// <param name="created">The scheduler created by this call, which the pipeline owns</param>
+    internal static TaskScheduler GetOrCreate(ref TaskScheduler? scheduler, string name, out InferenceScheduler? created)
+    {
+        created = null;
+        var current = Volatile.Read(ref scheduler);
+        if (current != null)
+            return current;
+
+        // Threads start only when a pipeline first runs an async call
+        var candidate = new InferenceScheduler(1, name);
+        current = Interlocked.CompareExchange(ref scheduler, candidate, null);
+        if (current != null)
+        {
+            candidate.Dispose();
+            return current;
+        }
+
+        created = candidate;
+        return candidate;
+    }
+
+    /// <summary>
+    /// Runs a blocking call on an inference thread
+    /// </summary>
+    /// <exception cref="ObjectDisposedException">The scheduler was disposed</exception>
+    internal static Task<T> Run<T>(TaskScheduler scheduler, Func<T> call, CancellationToken cancellationToken)
+    {
+        try
+        {
+            return Task.Factory.StartNew(call, cancellationToken, TaskCreationOptions.DenyChildAttach, scheduler);
+        }
+        catch (TaskSchedulerException e) when (e.InnerException is ObjectDisposedException disposed)
+        {
+            // StartNew wraps what QueueTask throws; report it the way a disposed pipeline is reported
+            throw disposed;
+        }
+    }
+
+    /// <inheritdoc cref="Run{T}(TaskScheduler, Func{T}, CancellationToken)"/>
+    internal static Task Run(TaskScheduler scheduler, Action call, CancellationToken cancellationToken)
+    {
+        try
+        {
+            return Task.Factory.StartNew(call, cancellationToken, TaskCreationOptions.DenyChildAttach, scheduler);
+        }
+        catch (TaskSchedulerException e) when (e.InnerException is ObjectDisposedException disposed)
+        {
+            throw disposed;
+        }
+    }
+
+    /// <inheritdoc/>
+    protected override void QueueTask(Task task)
+    {
+        try
+        {
+            _queue.Add(task);
+        }
+        catch (InvalidOperationException)
+        {
+            throw new ObjectDisposedException(nameof(InferenceScheduler));
+        }
+    }
+
+    /// <inheritdoc/>
+    protected override bool TryExecuteTaskInline(Task task, bool taskWasPreviouslyQueued)
+    {
+        // Only a call already on one of our threads may run inline, so nothing escapes the bound
+        return _workerOf == this && TryExecuteTask(task);
+    }
+
+    /// <inheritdoc/>
+    protected override IEnumerable<Task> GetScheduledTasks() => _queue.ToArray();
+
+    private void Work()
+    {
+        _workerOf = this;
+        foreach (var task in _queue.GetConsumingEnumerable())
+        {
+            var start = Stopwatch.GetTimestamp();
+            Interlocked.Increment(ref _busyWorkers);
+            try
+            {
+                TryExecuteTask(task);
+            }
+            finally
+            {
+                Interlocked.Decrement(ref _busyWorkers);
+                Interlocked.Add(ref _busyTicks, Stopwatch.GetTimestamp() - start);
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Measurement steps shared by <see cref="DeviceSelector"/> and <see cref="PerformanceProfile.AutoTuneAsync"/>
+/// </summary>
+internal static class LLMBenchmark
+{
+    /// <summary>
+    /// Measures one candidate on the thread pool
+    /// </summary>
+    /// <remarks>
+    /// Callers await each candidate before starting the next, so candidates run one at a time
+    /// and do not compete for cores or memory bandwidth.
+    /// </remarks>
+    public static Task<T> RunCandidateAsync<T>(Func<T> measure, CancellationToken cancellationToken)
+        => Task.Run(measure, cancellationToken);
+
+    /// <inheritdoc cref="RunCandidateAsync{T}(Func{T}, CancellationToken)"/>
+    public static Task<T> RunCandidateAsync<T>(Func<Task<T>> measure, CancellationToken cancellationToken)
+        => Task.Run(measure, cancellationToken);
+
+    /// <summary>
+    /// Runs one generation and discards it
+    /// </summary>
+    public static void WarmUp(LLMPipeline pipeline, string prompt, GenerationConfig config)
+    {
+        // The first inference allocates buffers and is not representative
+        using (pipeline.Generate(prompt, config))
+        {
+        }
+    }
+
+    /// <summary>
+    /// Warms the pipeline up, then returns the mean time to first token and time per output
+    /// token of the workload's prompt over the given number of generations, in milliseconds,
+    /// and the fewest tokens any of them generated
+    /// </summary>
+    /// <remarks>
+    /// A generation that stops after one token has no time per output token and reports zero,
+    /// so callers ranking on it check the generated token count.
+    /// </remarks>
+    public static (double TimeToFirstTokenMs, double TimePerOutputTokenMs, int GeneratedTokens) MeasureLatency(
+        LLMPipeline pipeline,
+        WorkloadProfile workload,
+        int iterations)
+    {
+        using var config = GenerationConfig.Default.WithMaxTokens(workload.BenchmarkTokens);
+        var prompt = workload.CreatePrompt();
+        WarmUp(pipeline, prompt, config);
+
+        double ttft = 0;
+        double tpot = 0;
+        var generated = int.MaxValue;
+        for (int i = 0; i < iterations; i++)
+        {
+            using var result = pipeline.Generate(prompt, config);
+            ttft += result.PerformanceMetrics.GetTimeToFirstToken().Mean;
+            tpot += result.PerformanceMetrics.GetTimePerOutputToken().Mean;
+            generated = Math.Min(generated, result.PerformanceMetrics.NumGenerationTokens);
+        }
+
+        return (ttft / iterations, tpot / iterations, generated);
+    }
+}
@@ -1,8 +1,13 @@
+using System.Buffers;
+using System.IO.Pipelines;
 using System.Runtime.CompilerServices;
+using System.Text;
 using System.Threading.Channels;
 using Fluid.OpenVINO.GenAI.Exceptions;
+using Fluid.OpenVINO.GenAI.Logging;
 using Fluid.OpenVINO.GenAI.Native;
 using Fluid.OpenVINO.GenAI.SafeHandles;
+using Microsoft.Extensions.Logging;
 
 namespace Fluid.OpenVINO.GenAI;
 
@@ -11,8 +16,16 @@ namespace Fluid.OpenVINO.GenAI;
 /// </summary>
 public sealed class LLMPipeline : IDisposable
 {
-    private readonly LLMPipelineSafeHandle _handle;
+    private readonly PipelineGate _gate;
+    private readonly ILogger _logger;
+    private readonly string _modelPath;
+    private readonly string _device;
+    private readonly PipelineProperties? _properties;
+    private readonly ReplicaPlacement? _placement;
+    private readonly LatencyTracker _latency = new();
     private bool _disposed;
+    private TaskScheduler? _scheduler;
+    private InferenceScheduler? _ownedScheduler;
 
     /// <summary>
     /// Initializes a new instance of the LLMPipeline class
@@ -20,23 +33,8 @@ public sealed class LLMPipeline : IDisposable
     /// <param name="modelPath">Path to the model directory</param>
     /// <param name="device">Device to run on (e.g., "CPU", "GPU")</param>
     public LLMPipeline(string modelPath, string device = "CPU")
+        : this(modelPath, device, (PipelineProperties?)null)
     {
-        if (string.IsNullOrEmpty(modelPath))
-            throw new ArgumentException("Model path cannot be null or empty", nameof(modelPath));
-        if (string.IsNullOrEmpty(device))
-            throw new ArgumentException("Device cannot be null or empty", nameof(device));
-
-        // Ensure native libraries are loaded before any P/Invoke calls
-        NativeLibraryLoader.EnsureLoaded();
-
-        var status = GenAINativeMethods.ov_genai_llm_pipeline_create(
-            modelPath,
-            device,
-            0, // No properties for now
-            out var handle);
-
-        OpenVINOGenAIException.ThrowIfError(status, "create LLM pipeline");
-        _handle = new LLMPipelineSafeHandle(handle, true);
     }
 
     /// <summary>
@@ -46,6 +44,29 @@ public sealed class LLMPipeline : IDisposable
     /// <param name="device">Device to run on (e.g., "CPU", "GPU")</param>
     /// <param name="properties">Additional properties (e.g., CACHE_DIR)</param>
     public LLMPipeline(string modelPath, string device, Dictionary<string, string>? properties)
+        : this(modelPath, device, properties != null ? PipelineProperties.FromDictionary(properties) : null)
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the LLMPipeline class with typed properties
+    /// </summary>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="device">Device to run on (e.g., "CPU", "GPU")</param>
+    /// <param name="properties">Device and compile properties (e.g., cache directory, thread count)</param>
+    public LLMPipeline(string modelPath, string device, PipelineProperties? properties)
+        : this(modelPath, device, properties, null)
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the LLMPipeline class placed on a NUMA node and set of cores
+    /// </summary>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="device">Device to run on (e.g., "CPU", "GPU")</param>
+    /// <param name="properties">Device and compile properties (e.g., cache directory, thread count)</param>
+    /// <param name="placement">NUMA node and cores for the pipeline, or null to let threads float</param>
+    public LLMPipeline(string modelPath, string device, PipelineProperties? properties, ReplicaPlacement? placement)
     {
         if (string.IsNullOrEmpty(modelPath))
             throw new ArgumentException("Model path cannot be null or empty", nameof(modelPath));
@@ -55,72 +76,84 @@ public sealed class LLMPipeline : IDisposable
         // Ensure native libraries are loaded before any P/Invoke calls
         NativeLibraryLoader.EnsureLoaded();
 
-        if (properties != null && properties.Count > 0)
-        {
-            ov_status_e status;
-            IntPtr handle;
-            
-            // Use the appropriate overload based on the number of properties
-            switch (properties.Count)
-            {
-                case 1:
-                    var prop1 = properties.First();
-                    status = GenAINativeMethods.ov_genai_llm_pipeline_create_with_1_property(
-                        modelPath,
-                        device,
-                        2, // 1 property = 2 args (key + value)
-                        out handle,
-                        prop1.Key,
-                        prop1.Value);
-                    break;
-                    
-                case 2:
-                    var props2 = properties.ToArray();
-                    status = GenAINativeMethods.ov_genai_llm_pipeline_create_with_2_properties(
-                        modelPath,
-                        device,
-                        4, // 2 properties = 4 args
-                        out handle,
-                        props2[0].Key,
-                        props2[0].Value,
-                        props2[1].Key,
-                        props2[1].Value);
-                    break;
-                    
-                case 3:
-                    var props3 = properties.ToArray();
-                    status = GenAINativeMethods.ov_genai_llm_pipeline_create_with_3_properties(
-                        modelPath,
-                        device,
-                        6, // 3 properties = 6 args
-                        out handle,
-                        props3[0].Key,
-                        props3[0].Value,
-                        props3[1].Key,
-                        props3[1].Value,
-                        props3[2].Key,
-                        props3[2].Value);
-                    break;
-                    
-                default:
-                    throw new ArgumentException("Maximum of 3 properties supported. If you need more, please extend the P/Invoke declarations.", nameof(properties));
-            }
+        properties = placement?.ApplyTo(properties, device) ?? properties;
 
-            OpenVINOGenAIException.ThrowIfError(status, "create LLM pipeline with properties");
-            _handle = new LLMPipelineSafeHandle(handle, true);
+        var privateBytesBefore = ProcessMemory.GetPrivateBytes();
+        ov_status_e status;
+        IntPtr handle;
+        using var binding = placement?.Bind();
+        if (properties == null || properties.Count == 0)
+        {
+            status = GenAINativeMethods.ov_genai_llm_pipeline_create(modelPath, device, 0, out handle);
         }
         else
         {
-            // No properties, use the simpler API
-            var status = GenAINativeMethods.ov_genai_llm_pipeline_create(
+            var args = properties.ToNativeArgs();
+            status = GenAINativeMethods.ov_genai_llm_pipeline_create_with_properties(
                 modelPath,
                 device,
-                0,
-                out var handle);
-
-            OpenVINOGenAIException.ThrowIfError(status, "create LLM pipeline");
-            _handle = new LLMPipelineSafeHandle(handle, true);
+                (nuint)(properties.Count * 2), // key + value per property
+                out handle,
+                args[0],
+                args[1],
+                args[2],
+                args[3],
+                args[4],
+                args[5],
+                args[6],
+                args[7],
+                args[8],
+                args[9],
+                args[10],
+                args[11],
+                args[12],
+                args[13],
+                args[14],
+                args[15]);
         }
+
+        OpenVINOGenAIException.ThrowIfError(status, "create LLM pipeline");
+        _gate = new PipelineGate(new LLMPipelineSafeHandle(handle, true), nameof(LLMPipeline));
+        PrivateMemoryBytes = Math.Max(0, ProcessMemory.GetPrivateBytes() - privateBytesBefore);
+
+        _modelPath = modelPath;
+        _device = device;
+        _properties = properties?.Clone();
+        _placement = placement;
+
+        _logger = GenAILogging.CreateLogger<LLMPipeline>();
+        Log.PipelineCreated(_logger, nameof(LLMPipeline), modelPath, device);
+    }
+
+    /// <summary>
+    /// Gets an approximation of the private memory the process gained while this pipeline
+    /// was created, in bytes
+    /// </summary>
+    /// <remarks>
+    /// This is the change in the whole process's private memory across the constructor, not
+    /// an accounting of the pipeline's own allocations: anything other threads allocate or
+    /// free meanwhile, including other pipelines being created, is included, and memory the
+    /// allocator reuses is not. Memory-mapped weights are shared and not included, so for
+    /// replicas created with <see cref="CloneShared"/> this estimates the per-replica cost.
+    /// </remarks>
+    public long PrivateMemoryBytes { get; }
+
+    /// <summary>
+    /// Creates another pipeline for the same model that shares this model's weights
+    /// </summary>
+    /// <remarks>
+    /// The replica uses this pipeline's model, device, properties and placement. Weights are
+    /// mapped read-only from the model files, OpenVINO's default, so their pages are shared by
+    /// every replica; KV caches and activations remain per replica. The replica turns mapping
+    /// on even if this pipeline was created with <c>WithMmap(false)</c>. Weights that the
+    /// device plugin converts at compile time are still copied per replica.
+    /// </remarks>
+    /// <returns>A new pipeline</returns>
+    public LLMPipeline CloneShared()
+    {
+        ThrowIfDisposed();
+        var properties = _properties?.Clone() ?? new PipelineProperties();
+        return new LLMPipeline(_modelPath, _device, properties.WithMmap(), _placement);
     }
 
     /// <summary>
@@ -135,12 +168,15 @@ public sealed class LLMPipeline : IDisposable
         if (string.IsNullOrEmpty(prompt))
             throw new ArgumentException("Prompt cannot be null or empty", nameof(prompt));
 
-        var configHandle = config?.Handle ?? IntPtr.Zero;
+        Log.GeneratingText(_logger, prompt.Length);
 
+        using var call = _gate.Enter();
+        using var configHandle = new HandleReference(config?.Handle);
+        using var binding = _placement?.Bind();
         var status = GenAINativeMethods.ov_genai_llm_pipeline_generate(
-            _handle.DangerousGetHandle(),
+            call.Handle,
             prompt,
-            configHandle,
+            configHandle.Value,
             IntPtr.Zero, // No streamer
             out var resultsHandle);
 
@@ -149,6 +185,37 @@ public sealed class LLMPipeline : IDisposable
         return new GenerationResult(new DecodedResultsSafeHandle(resultsHandle, true));
     }
 
+    /// <summary>
+    /// Generates text synchronously with per-request options
+    /// </summary>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="options">Options applied while decoding, such as a deadline or stop conditions</param>
+    /// <returns>The generation result</returns>
+    public GenerationResult Generate(string prompt, GenerationConfig? config, GenerationOptions options)
+        => Generate(prompt, config, new GenerationMonitor(options, _latency));
+
+    private GenerationResult Generate(string prompt, GenerationConfig? config, GenerationMonitor monitor)
+    {
+        ThrowIfDisposed();
+        if (string.IsNullOrEmpty(prompt))
+            throw new ArgumentException("Prompt cannot be null or empty", nameof(prompt));
+
+        Log.GeneratingText(_logger, prompt.Length);
+
+        // Options are applied per token, so the tokens go to a callback that keeps none of them
+        var callbackData = new StreamingCallbackData(null, _logger, monitor, CancellationToken.None);
+        var resultsHandle = GenerateWithStreamer(prompt, config, callbackData);
+        callbackData.ThrowIfError();
+        CompleteMonitor(monitor);
+
+        return new GenerationResult(new DecodedResultsSafeHandle(resultsHandle, true))
+        {
+            IsTruncatedByDeadline = monitor.IsTruncatedByDeadline,
+            IsStoppedByCondition = monitor.IsStoppedByCondition
+        };
+    }
+
     /// <summary>
     /// Generates text asynchronously
     /// </summary>
@@ -161,8 +228,31 @@ public sealed class LLMPipeline : IDisposable
         GenerationConfig? config = null,
         CancellationToken cancellationToken = default)
     {
-        // Run the synchronous generation on a background thread
-        return await Task.Run(() => Generate(prompt, config), cancellationToken);
+        ThrowIfDisposed();
+
+        // Wait for the pipeline, then run the synchronous generation on an inference thread
+        return await _gate.RunAsync(Scheduler, () => Generate(prompt, config), cancellationToken);
+    }
+
+    /// <summary>
+    /// Generates text asynchronously with per-request options
+    /// </summary>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="options">Options applied while decoding, such as a deadline or stop conditions</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>The generation result</returns>
+    public async Task<GenerationResult> GenerateAsync(
+        string prompt,
+        GenerationConfig? config,
+        GenerationOptions options,
+        CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+
+        // The deadline counts from the call, including the wait for the pipeline and a thread
+        var monitor = new GenerationMonitor(options, _latency);
+        return await _gate.RunAsync(Scheduler, () => Generate(prompt, config, monitor), cancellationToken);
     }
 
     /// <summary>
@@ -172,21 +262,239 @@ public sealed class LLMPipeline : IDisposable
     /// <param name="config">Generation configuration (optional)</param>
     /// <param name="cancellationToken">Cancellation token</param>
     /// <returns>An async enumerable of generated tokens</returns>
-    public async IAsyncEnumerable<string> GenerateStreamAsync(
+    public IAsyncEnumerable<string> GenerateStreamAsync(
         string prompt,
         GenerationConfig? config = null,
+        CancellationToken cancellationToken = default)
+    {
+        return StreamTokens(prompt, config, null, null, cancellationToken);
+    }
+
+    /// <summary>
+    /// Generates text with streaming output and per-request options
+    /// </summary>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="options">Options applied while decoding, such as a deadline or stop conditions</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>A stream of generated tokens that reports why generation ended</returns>
+    public GenerationStream GenerateStreamAsync(
+        string prompt,
+        GenerationConfig? config,
+        GenerationOptions options,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(options);
+        return new GenerationStream((stream, enumeratorToken) => StreamTokens(prompt, config, options, stream, cancellationToken, enumeratorToken));
+    }
+
+    private async IAsyncEnumerable<string> StreamTokens(
+        string prompt,
+        GenerationConfig? config,
+        GenerationOptions? options,
+        GenerationStream? stream,
+        CancellationToken callerToken,
         [EnumeratorCancellation] CancellationToken cancellationToken = default)
     {
         ThrowIfDisposed();
         if (string.IsNullOrEmpty(prompt))
             throw new ArgumentException("Prompt cannot be null or empty", nameof(prompt));
 
+        using var linked = callerToken.CanBeCanceled && cancellationToken.CanBeCanceled
+            ? CancellationTokenSource.CreateLinkedTokenSource(callerToken, cancellationToken)
+            : null;
+        cancellationToken = linked?.Token ?? (callerToken.CanBeCanceled ? callerToken : cancellationToken);
+
         var channel = Channel.CreateUnbounded<string>();
         var writer = channel.Writer;
         var reader = channel.Reader;
 
-        var callbackData = new StreamingCallbackData(writer, cancellationToken);
+        Log.GeneratingText(_logger, prompt.Length);
+        var monitor = new GenerationMonitor(options, _latency);
+        var callbackData = new StreamingCallbackData(writer, _logger, monitor, cancellationToken);
+        int inputTokens = 0, generatedTokens = 0;
+
+        // Start generation on an inference thread once the pipeline is free
+        var generationTask = _gate.RunAsync(Scheduler, () =>
+        {
+            try
+            {
+                // The tokens were streamed; only the token counts are kept
+                using var results = new GenerationResult(new DecodedResultsSafeHandle(GenerateWithStreamer(prompt, config, callbackData), true));
+                if (stream != null)
+                {
+                    var metrics = results.PerformanceMetrics;
+                    inputTokens = metrics.NumInputTokens;
+                    generatedTokens = metrics.NumGenerationTokens;
+                }
+            }
+            catch (Exception ex)
+            {
+                callbackData.SetError(ex);
+            }
+        }, cancellationToken);
+
+        // Also ends the tokens when the generation never started, e.g. because the pipeline was disposed
+        _ = generationTask.ContinueWith(
+            static (_, state) => ((ChannelWriter<string>)state!).TryComplete(),
+            writer,
+            CancellationToken.None,
+            TaskContinuationOptions.ExecuteSynchronously,
+            TaskScheduler.Default);
+
+        // Yield tokens as they arrive
+        await foreach (var token in reader.ReadAllAsync(cancellationToken))
+        {
+            yield return token;
+        }
+
+        // Wait for generation to complete and check for errors
+        await generationTask;
+        callbackData.ThrowIfError();
+
+        CompleteMonitor(monitor);
+        if (stream != null)
+        {
+            stream.IsTruncatedByDeadline = monitor.IsTruncatedByDeadline;
+            stream.IsStoppedByCondition = monitor.IsStoppedByCondition;
+            stream.InputTokens = inputTokens;
+            stream.GeneratedTokens = generatedTokens;
+        }
+    }
+
+    /// <summary>
+    /// Generates text into a pipe, writing each token's UTF-8 bytes straight into the writer's memory
+    /// </summary>
+    /// <remarks>
+    /// Tokens are written and flushed from the inference thread, batched by
+    /// <see cref="GenerationOptions.FlushInterval"/>. The inference thread never waits for the
+    /// reader: tokens written during a flush are held back until it completes, and a reader that
+    /// falls about a megabyte behind, or completes, stops decoding. The writer is flushed but not completed.
+    /// </remarks>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="writer">Pipe to write to, e.g. an HTTP response body</param>
+    /// <param name="format">Framing of the tokens</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="options">Options applied while decoding (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>What was written and why decoding ended</returns>
+    public async Task<StreamedGenerationResult> GenerateToAsync(
+        string prompt,
+        PipeWriter writer,
+        StreamFormat format = StreamFormat.Raw,
+        GenerationConfig? config = null,
+        GenerationOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+
+        var frames = new Utf8FrameWriter(writer, format, options?.FlushInterval ?? GenerationOptions.DefaultFlushInterval);
+        var result = await GenerateToAsync(prompt, frames, config, options, cancellationToken);
+
+        // The last tokens may still be batched
+        await frames.FlushAsync(cancellationToken);
+        return result;
+    }
+
+    /// <summary>
+    /// Generates text into a stream
+    /// </summary>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="stream">Stream to write to; it is left open</param>
+    /// <param name="format">Framing of the tokens</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="options">Options applied while decoding (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>What was written and why decoding ended</returns>
+    public async Task<StreamedGenerationResult> GenerateToAsync(
+        string prompt,
+        Stream stream,
+        StreamFormat format = StreamFormat.Raw,
+        GenerationConfig? config = null,
+        GenerationOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(stream);
+
+        var writer = PipeWriter.Create(stream, new StreamPipeWriterOptions(leaveOpen: true));
+        try
+        {
+            return await GenerateToAsync(prompt, writer, format, config, options, cancellationToken);
+        }
+        finally
+        {
+            await writer.CompleteAsync();
+        }
+    }
+
+    /// <summary>
+    /// Generates text into a buffer writer, such as an <see cref="ArrayBufferWriter{T}"/>
+    /// </summary>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="output">Buffer to write to; it is written from another thread until the task completes</param>
+    /// <param name="format">Framing of the tokens</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="options">Options applied while decoding (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>What was written and why decoding ended</returns>
+    public Task<StreamedGenerationResult> GenerateToAsync(
+        string prompt,
+        IBufferWriter<byte> output,
+        StreamFormat format = StreamFormat.Raw,
+        GenerationConfig? config = null,
+        GenerationOptions? options = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(output);
+
+        return GenerateToAsync(prompt, new Utf8FrameWriter(output, format, TimeSpan.Zero), config, options, cancellationToken);
+    }
+
+    private async Task<StreamedGenerationResult> GenerateToAsync(
+        string prompt,
+        Utf8FrameWriter frames,
+        GenerationConfig? config,
+        GenerationOptions? options,
+        CancellationToken cancellationToken)
+    {
+        ThrowIfDisposed();
+        if (string.IsNullOrEmpty(prompt))
+            throw new ArgumentException("Prompt cannot be null or empty", nameof(prompt));
+
+        // The deadline counts from the call, including the wait for the pipeline and a thread
+        var monitor = new GenerationMonitor(options, _latency);
+
+        await _gate.RunAsync(Scheduler, () =>
+        {
+            Log.GeneratingText(_logger, prompt.Length);
+
+            // Flushes started on the inference thread give up when the request or the pipeline ends
+            using var flushCancellation = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken, _gate.Closing);
+            var callbackData = new StreamingCallbackData(null, frames, _logger, monitor, cancellationToken)
+            {
+                FlushCancellation = flushCancellation.Token
+            };
+
+            // The tokens were written; the results are not needed
+            new DecodedResultsSafeHandle(GenerateWithStreamer(prompt, config, callbackData), true).Dispose();
+            callbackData.ThrowIfError();
+            CompleteMonitor(monitor);
+            if (frames.IsReaderStalled)
+                Log.GenerationStoppedByStalledReader(_logger, monitor.Tokens);
+        }, cancellationToken);
+
+        return new StreamedGenerationResult(monitor.Tokens, frames.BytesWritten, monitor.IsTruncatedByDeadline, monitor.IsStoppedByCondition);
+    }
+
+    /// <summary>
+    /// Runs a generation that reports every token to a streaming callback
+    /// </summary>
+    /// <returns>The native results handle, which the caller owns</returns>
+    private IntPtr GenerateWithStreamer(string prompt, GenerationConfig? config, StreamingCallbackData callbackData)
+    {
         var gcHandle = System.Runtime.InteropServices.GCHandle.Alloc(callbackData, System.Runtime.InteropServices.GCHandleType.Normal);
+        var streamerPtr = System.Runtime.InteropServices.Marshal.AllocHGlobal(
+            System.Runtime.InteropServices.Marshal.SizeOf<streamer_callback>());
 
         try
         {
@@ -195,64 +503,51 @@ public sealed class LLMPipeline : IDisposable
                 callback_func = StreamingCallbackFunction.FunctionPointer,
                 args = System.Runtime.InteropServices.GCHandle.ToIntPtr(gcHandle)
             };
+            System.Runtime.InteropServices.Marshal.StructureToPtr(streamerCallback, streamerPtr, false);
 
-            var configHandle = config?.Handle ?? IntPtr.Zero;
+            using var call = _gate.Enter();
+            using var configHandle = new HandleReference(config?.Handle);
 
-            // Start generation in a background task
-            var generationTask = Task.Run(() =>
-            {
-                try
-                {
-                    var streamerPtr = System.Runtime.InteropServices.Marshal.AllocHGlobal(
-                        System.Runtime.InteropServices.Marshal.SizeOf<streamer_callback>());
-
-                    try
-                    {
-                        System.Runtime.InteropServices.Marshal.StructureToPtr(streamerCallback, streamerPtr, false);
-
-                        var status = GenAINativeMethods.ov_genai_llm_pipeline_generate(
-                            _handle.DangerousGetHandle(),
-                            prompt,
-                            configHandle,
-                            streamerPtr,
-                            out _); // We don't need the results when streaming
-
-                        if (status != ov_status_e.OK)
-                        {
-                            callbackData.SetError(new OpenVINOGenAIException(status, "stream generation failed"));
-                        }
-                    }
-                    finally
-                    {
-                        System.Runtime.InteropServices.Marshal.FreeHGlobal(streamerPtr);
-                    }
-                }
-                catch (Exception ex)
-                {
-                    callbackData.SetError(ex);
-                }
-                finally
-                {
-                    writer.TryComplete();
-                }
-            }, cancellationToken);
+            // Disposing the pipeline cancels the generation at its next token
+            callbackData.Closing = _gate.Closing;
+            using var binding = _placement?.Bind();
 
-            // Yield tokens as they arrive
-            await foreach (var token in reader.ReadAllAsync(cancellationToken))
+            // The wait for the pipeline counts against the deadline but not the measured latency
+            callbackData.Monitor.Begin();
+            var status = GenAINativeMethods.ov_genai_llm_pipeline_generate(
+                call.Handle,
+                prompt,
+                configHandle.Value,
+                streamerPtr,
+                out var resultsHandle);
+
+            if (_gate.Closing.IsCancellationRequested)
             {
-                yield return token;
+                if (status == ov_status_e.OK)
+                    new DecodedResultsSafeHandle(resultsHandle, true).Dispose();
+                throw new ObjectDisposedException(nameof(LLMPipeline));
             }
 
-            // Wait for generation to complete and check for errors
-            await generationTask;
-            callbackData.ThrowIfError();
+            OpenVINOGenAIException.ThrowIfError(status, "generate text");
+            return resultsHandle;
         }
         finally
         {
-            if (gcHandle.IsAllocated)
-            {
-                gcHandle.Free();
-            }
+            System.Runtime.InteropServices.Marshal.FreeHGlobal(streamerPtr);
+            gcHandle.Free();
+        }
+    }
+
+    private void CompleteMonitor(GenerationMonitor monitor)
+    {
+        monitor.Complete();
+        if (monitor.IsTruncatedByDeadline)
+        {
+            Log.GenerationStoppedAtDeadline(_logger, monitor.Tokens, monitor.Elapsed.TotalMilliseconds);
+        }
+        else if (monitor.IsStoppedByCondition)
+        {
+            Log.GenerationStoppedByCondition(_logger, monitor.Tokens);
         }
     }
 
@@ -263,7 +558,8 @@ public sealed class LLMPipeline : IDisposable
     {
         ThrowIfDisposed();
 
-        var status = GenAINativeMethods.ov_genai_llm_pipeline_start_chat(_handle.DangerousGetHandle());
+        using var call = _gate.Enter();
+        var status = GenAINativeMethods.ov_genai_llm_pipeline_start_chat(call.Handle);
         OpenVINOGenAIException.ThrowIfError(status, "start chat");
     }
 
@@ -274,7 +570,8 @@ public sealed class LLMPipeline : IDisposable
     {
         ThrowIfDisposed();
 
-        var status = GenAINativeMethods.ov_genai_llm_pipeline_finish_chat(_handle.DangerousGetHandle());
+        using var call = _gate.Enter();
+        var status = GenAINativeMethods.ov_genai_llm_pipeline_finish_chat(call.Handle);
         OpenVINOGenAIException.ThrowIfError(status, "finish chat");
     }
 
@@ -286,8 +583,9 @@ public sealed class LLMPipeline : IDisposable
     {
         ThrowIfDisposed();
 
+        using var call = _gate.Enter();
         var status = GenAINativeMethods.ov_genai_llm_pipeline_get_generation_config(
-            _handle.DangerousGetHandle(),
+            call.Handle,
             out var configHandle);
 
         OpenVINOGenAIException.ThrowIfError(status, "get generation config");
@@ -304,22 +602,80 @@ public sealed class LLMPipeline : IDisposable
         ThrowIfDisposed();
         ArgumentNullException.ThrowIfNull(config);
 
+        using var call = _gate.Enter();
+        using var configHandle = new HandleReference(config.Handle);
         var status = GenAINativeMethods.ov_genai_llm_pipeline_set_generation_config(
-            _handle.DangerousGetHandle(),
-            config.Handle);
+            call.Handle,
+            configHandle.Value);
 
         OpenVINOGenAIException.ThrowIfError(status, "set generation config");
     }
 
+    /// <summary>
+    /// Gets or sets the scheduler that runs the blocking native calls of the async APIs
+    /// </summary>
+    /// <remarks>
+    /// Defaults to a dedicated thread owned by the pipeline, started on first use. Assign a shared
+    /// <see cref="InferenceScheduler"/> to bound inference threads across pipelines, or
+    /// <see cref="TaskScheduler.Default"/> to use the thread pool.
+    /// </remarks>
+    /// <exception cref="ObjectDisposedException">Read after the pipeline was disposed</exception>
+    public TaskScheduler Scheduler
+    {
+        get
+        {
+            ThrowIfDisposed();
+            var scheduler = InferenceScheduler.GetOrCreate(ref _scheduler, "LLM inference", out var created);
+            if (created != null)
+            {
+                // Dispose may have run while the scheduler was created; it must not outlive the pipeline
+                Interlocked.Exchange(ref _ownedScheduler, created);
+                if (Volatile.Read(ref _disposed))
+                {
+                    created.Dispose();
+                    ThrowIfDisposed();
+                }
+            }
+            return scheduler;
+        }
+        set
+        {
+            ArgumentNullException.ThrowIfNull(value);
+            var previous = Interlocked.Exchange(ref _scheduler, value);
+            if (previous != value && previous is InferenceScheduler owned && owned == _ownedScheduler)
+            {
+                // Calls already queued still run
+                _ownedScheduler = null;
+                owned.Dispose();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Gets the number of generations and other native calls running or waiting for the pipeline
+    /// </summary>
+    public int ActiveGenerations => _gate.ActiveCalls;
+
     /// <summary>
     /// Releases all resources used by the LLMPipeline
     /// </summary>
+    /// <remarks>
+    /// Streaming generations in flight are canceled at their next token and fail with
+    /// <see cref="ObjectDisposedException"/>, as do calls still waiting for the pipeline.
+    /// Dispose waits up to 30 seconds for running calls to return; the native pipeline is freed
+    /// once the last of them has.
+    /// </remarks>
     public void Dispose()
     {
         if (!_disposed)
         {
-            _handle?.Dispose();
             _disposed = true;
+            var running = _gate?.Close() ?? 0;
+            if (running > 0)
+            {
+                Log.PipelineDisposedWhileBusy(_logger, nameof(LLMPipeline), running);
+            }
+            Interlocked.Exchange(ref _ownedScheduler, null)?.Dispose();
         }
     }
 
@@ -338,24 +694,59 @@ public sealed class LLMPipeline : IDisposable
 /// </summary>
 internal sealed class StreamingCallbackData
 {
-    private readonly ChannelWriter<string> _writer;
+    private readonly ChannelWriter<string>? _writer;
+    private readonly Utf8FrameWriter? _frames;
     private readonly CancellationToken _cancellationToken;
     private Exception? _error;
 
-    public StreamingCallbackData(ChannelWriter<string> writer, CancellationToken cancellationToken)
+    public StreamingCallbackData(ChannelWriter<string>? writer, ILogger logger, GenerationMonitor monitor, CancellationToken cancellationToken)
+        : this(writer, null, logger, monitor, cancellationToken)
+    {
+    }
+
+    public StreamingCallbackData(ChannelWriter<string>? writer, Utf8FrameWriter? frames, ILogger logger, GenerationMonitor monitor, CancellationToken cancellationToken)
     {
         _writer = writer;
+        _frames = frames;
+        Logger = logger;
+        Monitor = monitor;
         _cancellationToken = cancellationToken;
     }
 
-    public void WriteToken(string token)
+    public ILogger Logger { get; }
+
+    public GenerationMonitor Monitor { get; }
+
+    /// <summary>
+    /// Canceled when the pipeline is disposed
+    /// </summary>
+    public CancellationToken Closing { get; set; }
+
+    /// <summary>
+    /// Cancels flushes of the frame writer
+    /// </summary>
+    public CancellationToken FlushCancellation { get; init; }
+
+    /// <summary>
+    /// Passes a token to the consumer
+    /// </summary>
+    /// <returns>False if the consumer will read nothing more</returns>
+    public bool WriteToken(ReadOnlySpan<byte> utf8)
     {
         if (_cancellationToken.IsCancellationRequested)
         {
-            return;
+            return true;
+        }
+
+        _writer?.TryWrite(Encoding.UTF8.GetString(utf8));
+
+        if (_frames != null)
+        {
+            _frames.WriteToken(utf8);
+            return _frames.FlushIfDue(FlushCancellation);
         }
 
-        _writer.TryWrite(token);
+        return true;
     }
 
     public void SetError(Exception error)
@@ -371,7 +762,7 @@ internal sealed class StreamingCallbackData
         }
     }
 
-    public bool IsCancellationRequested => _cancellationToken.IsCancellationRequested;
+    public bool IsCancellationRequested => _cancellationToken.IsCancellationRequested || Closing.IsCancellationRequested;
 }
 
 /// <summary>
@@ -379,28 +770,48 @@ internal sealed class StreamingCallbackData
 /// </summary>
 internal static class StreamingCallbackFunction
 {
+    // The delegate must stay reachable for as long as native code may call the pointer
+    private static readonly StreamerCallbackUtf8Func Callback = CallbackImpl;
+
     public static readonly IntPtr FunctionPointer =
-        System.Runtime.InteropServices.Marshal.GetFunctionPointerForDelegate<StreamerCallbackFunc>(CallbackImpl);
+        System.Runtime.InteropServices.Marshal.GetFunctionPointerForDelegate(Callback);
 
-    private static ov_genai_streamming_status_e CallbackImpl(string str, IntPtr args)
+    private static unsafe ov_genai_streamming_status_e CallbackImpl(IntPtr str, IntPtr args)
     {
+        StreamingCallbackData? callbackData = null;
         try
         {
             var gcHandle = System.Runtime.InteropServices.GCHandle.FromIntPtr(args);
-            var callbackData = (StreamingCallbackData)gcHandle.Target!;
+            callbackData = (StreamingCallbackData)gcHandle.Target!;
 
             if (callbackData.IsCancellationRequested)
             {
                 return ov_genai_streamming_status_e.CANCEL;
             }
 
-            callbackData.WriteToken(str);
-            return ov_genai_streamming_status_e.RUNNING;
+            // The token's UTF-8 bytes are read in place; only consumers that need a string decode them
+            var utf8 = str == IntPtr.Zero
+                ? ReadOnlySpan<byte>.Empty
+                : System.Runtime.InteropServices.MemoryMarshal.CreateReadOnlySpanFromNullTerminated((byte*)str);
+
+            if (!callbackData.WriteToken(utf8))
+            {
+                return ov_genai_streamming_status_e.STOP;
+            }
+
+            // STOP ends decoding but keeps the tokens produced so far
+            return callbackData.Monitor.OnToken(utf8)
+                ? ov_genai_streamming_status_e.STOP
+                : ov_genai_streamming_status_e.RUNNING;
         }
         catch (Exception ex)
         {
-            // Log error if needed, but can't throw from callback
-            System.Diagnostics.Debug.WriteLine($"Streaming callback error: {ex}");
+            // Can't throw from the callback: record the error so the caller rethrows it
+            if (callbackData != null)
+            {
+                Log.StreamingCallbackFailed(callbackData.Logger, ex);
+                callbackData.SetError(ex);
+            }
             return ov_genai_streamming_status_e.STOP;
         }
     }
@@ -0,0 +1,29 @@
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Abstractions;
+
+namespace Fluid.OpenVINO.GenAI.Logging;
+
+/// <summary>
+/// Configures where library diagnostics are written
+/// </summary>
+/// <remarks>
+/// Diagnostics are discarded by default. Set <see cref="LoggerFactory"/> before creating
+/// pipelines to receive them; pipelines capture their logger when they are created.
+/// </remarks>
+public static class GenAILogging
+{
+    private static ILoggerFactory _loggerFactory = NullLoggerFactory.Instance;
+
+    /// <summary>
+    /// Gets or sets the logger factory used by the library
+    /// </summary>
+    public static ILoggerFactory LoggerFactory
+    {
+        get => Volatile.Read(ref _loggerFactory);
+        set => Volatile.Write(ref _loggerFactory, value ?? NullLoggerFactory.Instance);
+    }
+
+    internal static ILogger CreateLogger<T>() => LoggerFactory.CreateLogger<T>();
+
+    internal static ILogger CreateLogger(string categoryName) => LoggerFactory.CreateLogger(categoryName);
+}
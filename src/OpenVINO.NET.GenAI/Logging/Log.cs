@@ -0,0 +1,115 @@
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI.Logging;
+
+/// <summary>
+/// Source-generated log messages. Each method checks the level before formatting,
+/// so disabled messages cost no formatting or allocation.
+/// </summary>
+internal static partial class Log
+{
+    // Native library loading (1xx)
+
+    [LoggerMessage(EventId = 100, Level = LogLevel.Debug, Message = "Setting DLL directory to {Directory}")]
+    internal static partial void SettingDllDirectory(ILogger logger, string directory);
+
+    [LoggerMessage(EventId = 101, Level = LogLevel.Warning, Message = "Failed to set DLL directory to {Directory}")]
+    internal static partial void SetDllDirectoryFailed(ILogger logger, string directory);
+
+    [LoggerMessage(EventId = 102, Level = LogLevel.Debug, Message = "OPENVINO_RUNTIME_PATH: {RuntimePath}")]
+    internal static partial void RuntimePath(ILogger logger, string? runtimePath);
+
+    [LoggerMessage(EventId = 103, Level = LogLevel.Warning, Message = "Could not search subdirectories of {BasePath}")]
+    internal static partial void SubdirectorySearchFailed(ILogger logger, string basePath, Exception exception);
+
+    [LoggerMessage(EventId = 104, Level = LogLevel.Debug, Message = "Failed to load {Path}")]
+    internal static partial void LibraryLoadFailed(ILogger logger, string path, Exception exception);
+
+    [LoggerMessage(EventId = 105, Level = LogLevel.Debug, Message = "Could not preload dependency {Dependency}")]
+    internal static partial void PreloadFailed(ILogger logger, string dependency, Exception exception);
+
+    [LoggerMessage(EventId = 106, Level = LogLevel.Debug, Message = "Loaded native library {Path}")]
+    internal static partial void LibraryLoaded(ILogger logger, string path);
+
+    // Pipelines (2xx)
+
+    [LoggerMessage(EventId = 200, Level = LogLevel.Information, Message = "Created {PipelineType} pipeline for {ModelPath} on {Device}")]
+    internal static partial void PipelineCreated(ILogger logger, string pipelineType, string modelPath, string device);
+
+    [LoggerMessage(EventId = 201, Level = LogLevel.Debug, Message = "Generating text from a {PromptLength} character prompt")]
+    internal static partial void GeneratingText(ILogger logger, int promptLength);
+
+    [LoggerMessage(EventId = 202, Level = LogLevel.Debug, Message = "Transcribing {SampleCount} samples")]
+    internal static partial void Transcribing(ILogger logger, int sampleCount);
+
+    [LoggerMessage(EventId = 203, Level = LogLevel.Debug, Message = "Transcription produced {ResultCount} results")]
+    internal static partial void TranscriptionCompleted(ILogger logger, int resultCount);
+
+    [LoggerMessage(EventId = 204, Level = LogLevel.Error, Message = "Transcription failed")]
+    internal static partial void TranscriptionFailed(ILogger logger, Exception exception);
+
+    [LoggerMessage(EventId = 205, Level = LogLevel.Debug, Message = "Transcription served from cache")]
+    internal static partial void TranscriptionCacheHit(ILogger logger);
+
+    [LoggerMessage(EventId = 206, Level = LogLevel.Warning, Message = "Disposed {PipelineType} pipeline with {CallCount} calls still running; it is freed when they return")]
+    internal static partial void PipelineDisposedWhileBusy(ILogger logger, string pipelineType, int callCount);
+
+    // Streaming (3xx)
+
+    [LoggerMessage(EventId = 300, Level = LogLevel.Error, Message = "Streaming callback failed; generation is stopped")]
+    internal static partial void StreamingCallbackFailed(ILogger logger, Exception exception);
+
+    [LoggerMessage(EventId = 301, Level = LogLevel.Debug, Message = "Stopped after {TokenCount} tokens to meet the deadline ({ElapsedMs:F0} ms elapsed)")]
+    internal static partial void GenerationStoppedAtDeadline(ILogger logger, int tokenCount, double elapsedMs);
+
+    [LoggerMessage(EventId = 302, Level = LogLevel.Debug, Message = "Stopped after {TokenCount} tokens by a stop condition")]
+    internal static partial void GenerationStoppedByCondition(ILogger logger, int tokenCount);
+
+    [LoggerMessage(EventId = 303, Level = LogLevel.Warning, Message = "Stopped after {TokenCount} tokens because the reader fell too far behind")]
+    internal static partial void GenerationStoppedByStalledReader(ILogger logger, int tokenCount);
+
+    // Caching (4xx)
+
+    [LoggerMessage(EventId = 400, Level = LogLevel.Warning, Message = "Could not read cache entry {Path}; transcribing again")]
+    internal static partial void CacheReadFailed(ILogger logger, string path, Exception exception);
+
+    [LoggerMessage(EventId = 401, Level = LogLevel.Warning, Message = "Could not write cache entry {Path}")]
+    internal static partial void CacheWriteFailed(ILogger logger, string path, Exception exception);
+
+    [LoggerMessage(EventId = 402, Level = LogLevel.Warning, Message = "Could not read tuning file {Path}; measuring again")]
+    internal static partial void TuningStoreReadFailed(ILogger logger, string path, Exception exception);
+
+    [LoggerMessage(EventId = 403, Level = LogLevel.Warning, Message = "Could not write tuning file {Path}")]
+    internal static partial void TuningStoreWriteFailed(ILogger logger, string path, Exception exception);
+
+    // Model management (6xx)
+
+    [LoggerMessage(EventId = 600, Level = LogLevel.Information, Message = "Loading model {ModelId} ({MemoryBytes} bytes)")]
+    internal static partial void ModelLoading(ILogger logger, string modelId, long memoryBytes);
+
+    [LoggerMessage(EventId = 601, Level = LogLevel.Information, Message = "Evicted idle model {ModelId}")]
+    internal static partial void ModelEvicted(ILogger logger, string modelId);
+
+    [LoggerMessage(EventId = 602, Level = LogLevel.Error, Message = "Model {ModelId} failed to load")]
+    internal static partial void ModelLoadFailed(ILogger logger, string modelId, Exception exception);
+
+    // Device selection (7xx)
+
+    [LoggerMessage(EventId = 700, Level = LogLevel.Information, Message = "Benchmarked {Candidate}: TTFT {TimeToFirstTokenMs:F1} ms, TPOT {TimePerOutputTokenMs:F1} ms")]
+    internal static partial void DeviceBenchmarked(ILogger logger, string candidate, double timeToFirstTokenMs, double timePerOutputTokenMs);
+
+    [LoggerMessage(EventId = 701, Level = LogLevel.Warning, Message = "Candidate {Candidate} could not run the model")]
+    internal static partial void DeviceBenchmarkFailed(ILogger logger, string candidate, Exception exception);
+
+    [LoggerMessage(EventId = 702, Level = LogLevel.Information, Message = "Selected {Candidate} for {ModelPath} (stored: {FromCache})")]
+    internal static partial void DeviceSelected(ILogger logger, string candidate, string modelPath, bool fromCache);
+
+    [LoggerMessage(EventId = 703, Level = LogLevel.Information, Message = "Measured {Profile}: {Score:F1}")]
+    internal static partial void ProfileMeasured(ILogger logger, string profile, double score);
+
+    [LoggerMessage(EventId = 704, Level = LogLevel.Warning, Message = "Settings {Profile} could not run the model")]
+    internal static partial void ProfileFailed(ILogger logger, string profile, Exception exception);
+
+    [LoggerMessage(EventId = 705, Level = LogLevel.Information, Message = "Tuned {Profile} for {ModelPath} (stored: {FromCache})")]
+    internal static partial void ProfileTuned(ILogger logger, string profile, string modelPath, bool fromCache);
+}
@@ -0,0 +1,565 @@
+using Fluid.OpenVINO.GenAI.Logging;
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Loads pipelines on demand by model id and keeps as many loaded as fit in a memory budget
+/// </summary>
+/// <remarks>
+/// Each acquired lease holds a reference to its model; a model is only evicted when it has no
+/// leases, least recently used first, and only when another model needs its memory. When all
+/// loaded models are in use, acquiring an unloaded model waits for a lease to be released.
+/// Leases of the same model share one pipeline instance; register a factory that returns a
+/// <see cref="PipelinePool{TPipeline}"/> when a model must serve several callers at once.
+/// </remarks>
+public sealed class ModelManager : IDisposable
+{
+    private readonly Dictionary<string, ModelEntry> _entries = new(StringComparer.Ordinal);
+    private readonly object _lock = new();
+    private readonly ILogger _logger;
+    private TaskCompletionSource<bool> _capacityChanged = NewSignal();
+    private ModelEntry? _lastAcquired;
+    private long _clock;
+    private long _memoryInUse;
+    private long _loads;
+    private long _evictions;
+    private bool _disposed;
+
+    /// <summary>
+    /// Initializes a new instance of the ModelManager class
+    /// </summary>
+    /// <param name="memoryBudgetBytes">Total estimated memory of the models that may be loaded at once</param>
+    public ModelManager(long memoryBudgetBytes)
+    {
+        if (memoryBudgetBytes <= 0)
+            throw new ArgumentOutOfRangeException(nameof(memoryBudgetBytes), "Memory budget must be positive");
+
+        MemoryBudget = memoryBudgetBytes;
+        _logger = GenAILogging.CreateLogger<ModelManager>();
+    }
+
+    /// <summary>
+    /// Gets the memory budget in bytes
+    /// </summary>
+    public long MemoryBudget { get; }
+
+    /// <summary>
+    /// Gets the estimated memory of the loaded and loading models in bytes
+    /// </summary>
+    public long MemoryInUse => Interlocked.Read(ref _memoryInUse);
+
+    /// <summary>
+    /// Gets the number of models loaded so far
+    /// </summary>
+    public long Loads => Interlocked.Read(ref _loads);
+
+    /// <summary>
+    /// Gets the number of models evicted so far
+    /// </summary>
+    public long Evictions => Interlocked.Read(ref _evictions);
+
+    /// <summary>
+    /// Gets or sets whether the model most often requested after the current one is loaded in
+    /// the background. Prediction only uses free budget and never evicts a model.
+    /// </summary>
+    public bool EnablePrefetch { get; set; } = true;
+
+    /// <summary>
+    /// Registers an LLM
+    /// </summary>
+    /// <param name="modelId">Model id used to acquire the model</param>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="device">Target device</param>
+    /// <param name="properties">Device properties (optional)</param>
+    /// <param name="memoryBytes">Estimated memory of the loaded model; defaults to the size of the weights</param>
+    public void RegisterLLM(
+        string modelId,
+        string modelPath,
+        string device = "CPU",
+        PipelineProperties? properties = null,
+        long? memoryBytes = null)
+    {
+        Register(modelId, () => new LLMPipeline(modelPath, device, properties), memoryBytes ?? EstimateMemory(modelPath));
+    }
+
+    /// <summary>
+    /// Registers a Whisper model
+    /// </summary>
+    /// <param name="modelId">Model id used to acquire the model</param>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="device">Target device</param>
+    /// <param name="properties">Device properties (optional)</param>
+    /// <param name="memoryBytes">Estimated memory of the loaded model; defaults to the size of the weights</param>
+    public void RegisterWhisper(
+        string modelId,
+        string modelPath,
+        string device = "CPU",
+        PipelineProperties? properties = null,
+        long? memoryBytes = null)
+    {
+        Register(modelId, () => new WhisperPipeline(modelPath, device, properties), memoryBytes ?? EstimateMemory(modelPath));
+    }
+
+    /// <summary>
+    /// Registers a model created by a factory
+    /// </summary>
+    /// <typeparam name="TPipeline">Pipeline type</typeparam>
+    /// <param name="modelId">Model id used to acquire the model</param>
+    /// <param name="factory">Factory that loads the model</param>
+    /// <param name="memoryBytes">Estimated memory of the loaded model</param>
+    public void Register<TPipeline>(string modelId, Func<TPipeline> factory, long memoryBytes)
+        where TPipeline : class, IDisposable
+    {
+        if (string.IsNullOrEmpty(modelId))
+            throw new ArgumentException("Model id cannot be null or empty", nameof(modelId));
+        if (factory == null)
+            throw new ArgumentNullException(nameof(factory));
+        if (memoryBytes < 0 || memoryBytes > MemoryBudget)
+            throw new ArgumentOutOfRangeException(nameof(memoryBytes), "Model memory must be between zero and the memory budget");
+
+        lock (_lock)
+        {
+            ThrowIfDisposed();
+            if (_entries.ContainsKey(modelId))
+                throw new ArgumentException($"Model '{modelId}' is already registered", nameof(modelId));
+
+            _entries.Add(modelId, new ModelEntry(modelId, typeof(TPipeline), factory, memoryBytes));
+        }
+    }
+
+    /// <summary>
+    /// Estimates the memory of a model from the size of its weight files
+    /// </summary>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <returns>Estimated memory in bytes</returns>
+    public static long EstimateMemory(string modelPath)
+    {
+        if (!Directory.Exists(modelPath))
+            throw new DirectoryNotFoundException($"Model directory not found: {modelPath}");
+
+        return new DirectoryInfo(modelPath).EnumerateFiles("*.bin").Sum(f => f.Length);
+    }
+
+    /// <summary>
+    /// Gets the ids of the loaded models
+    /// </summary>
+    public IReadOnlyList<string> GetLoadedModels()
+    {
+        lock (_lock)
+        {
+            return _entries.Values.Where(e => e.Instance != null).Select(e => e.Id).ToList();
+        }
+    }
+
+    /// <summary>
+    /// Acquires a model, loading it if necessary
+    /// </summary>
+    /// <typeparam name="TPipeline">Pipeline type the model was registered with</typeparam>
+    /// <param name="modelId">Model id</param>
+    /// <param name="cancellationToken">Cancels waiting for memory or for the load; an ongoing load continues</param>
+    /// <returns>A lease; dispose it to release the model</returns>
+    public async Task<ModelLease<TPipeline>> AcquireAsync<TPipeline>(string modelId, CancellationToken cancellationToken = default)
+        where TPipeline : class, IDisposable
+    {
+        var entry = GetEntry(modelId, typeof(TPipeline));
+
+        while (true)
+        {
+            Task wait;
+            List<IDisposable>? evicted = null;
+            lock (_lock)
+            {
+                ThrowIfDisposed();
+                if (entry.Instance != null)
+                {
+                    entry.RefCount++;
+                    entry.LastUsed = ++_clock;
+                    var prefetch = RecordAccess(entry);
+                    var lease = new ModelLease<TPipeline>(this, entry, (TPipeline)entry.Instance);
+                    if (prefetch != null)
+                        StartLoad(prefetch);
+                    return lease;
+                }
+
+                if (entry.LoadTask == null && TryReserve(entry, allowEviction: true, out evicted))
+                {
+                    StartLoad(entry);
+                }
+
+                wait = entry.LoadTask ?? _capacityChanged.Task;
+            }
+
+            DisposeEvicted(evicted);
+
+            // A failed load is reported to every caller waiting for it
+            await wait.WaitAsync(cancellationToken).ConfigureAwait(false);
+        }
+    }
+
+    /// <summary>
+    /// Loads a model ahead of use, evicting idle models if necessary
+    /// </summary>
+    /// <param name="modelId">Model id</param>
+    /// <param name="cancellationToken">Cancels waiting for the load; an ongoing load continues</param>
+    /// <returns>True if the model is loaded; false if the memory is held by models in use</returns>
+    public async Task<bool> PrefetchAsync(string modelId, CancellationToken cancellationToken = default)
+    {
+        var entry = GetEntry(modelId, null);
+        Task? load;
+        List<IDisposable>? evicted = null;
+        lock (_lock)
+        {
+            ThrowIfDisposed();
+            if (entry.Instance != null)
+                return true;
+
+            if (entry.LoadTask == null && TryReserve(entry, allowEviction: true, out evicted))
+            {
+                StartLoad(entry);
+            }
+
+            load = entry.LoadTask;
+        }
+
+        DisposeEvicted(evicted);
+        if (load == null)
+            return false;
+
+        await load.WaitAsync(cancellationToken).ConfigureAwait(false);
+        return true;
+    }
+
+    /// <summary>
+    /// Unloads a model that has no leases
+    /// </summary>
+    /// <param name="modelId">Model id</param>
+    /// <returns>True if the model was unloaded</returns>
+    public bool Unload(string modelId)
+    {
+        var entry = GetEntry(modelId, null);
+        IDisposable instance;
+        lock (_lock)
+        {
+            if (entry.Instance == null || entry.RefCount > 0)
+                return false;
+
+            instance = Evict(entry);
+            SignalCapacity();
+        }
+
+        instance.Dispose();
+        return true;
+    }
+
+    internal void Release(ModelEntry entry)
+    {
+        lock (_lock)
+        {
+            entry.RefCount--;
+            entry.LastUsed = ++_clock;
+            if (entry.RefCount == 0)
+                SignalCapacity();
+        }
+    }
+
+    private ModelEntry GetEntry(string modelId, Type? pipelineType)
+    {
+        if (modelId == null)
+            throw new ArgumentNullException(nameof(modelId));
+
+        lock (_lock)
+        {
+            ThrowIfDisposed();
+            if (!_entries.TryGetValue(modelId, out var entry))
+                throw new KeyNotFoundException($"Model '{modelId}' is not registered");
+            if (pipelineType != null && entry.PipelineType != pipelineType)
+                throw new InvalidOperationException($"Model '{modelId}' is a {entry.PipelineType.Name}, not a {pipelineType.Name}");
+
+            return entry;
+        }
+    }
+
+    /// <summary>
+    /// Reserves memory for a model, evicting idle models in LRU order if allowed. Nothing is
+    /// evicted unless the eviction frees enough memory. Called under the lock.
+    /// </summary>
+    private bool TryReserve(ModelEntry entry, bool allowEviction, out List<IDisposable>? evicted)
+    {
+        evicted = null;
+        var free = MemoryBudget - _memoryInUse;
+        if (entry.MemoryBytes <= free)
+        {
+            Reserve(entry);
+            return true;
+        }
+
+        if (!allowEviction)
+            return false;
+
+        var victims = new List<ModelEntry>();
+        foreach (var candidate in _entries.Values
+            .Where(e => e.Instance != null && e.RefCount == 0)
+            .OrderBy(e => e.LastUsed))
+        {
+            victims.Add(candidate);
+            free += candidate.MemoryBytes;
+            if (entry.MemoryBytes <= free)
+                break;
+        }
+
+        if (entry.MemoryBytes > free)
+            return false;
+
+        evicted = victims.Select(Evict).ToList();
+        Reserve(entry);
+        return true;
+    }
+
+    private void Reserve(ModelEntry entry)
+    {
+        entry.IsReserved = true;
+        _memoryInUse += entry.MemoryBytes;
+    }
+
+    /// <summary>
+    /// Returns a model's memory to the budget at most once per reservation, so a release
+    /// racing with <see cref="Dispose"/>, which clears every reservation, is harmless.
+    /// Called under the lock.
+    /// </summary>
+    private void ReleaseReservation(ModelEntry entry)
+    {
+        if (!entry.IsReserved)
+            return;
+
+        entry.IsReserved = false;
+        _memoryInUse -= entry.MemoryBytes;
+    }
+
+    private IDisposable Evict(ModelEntry entry)
+    {
+        var instance = entry.Instance!;
+        entry.Instance = null;
+        ReleaseReservation(entry);
+        Interlocked.Increment(ref _evictions);
+        Log.ModelEvicted(_logger, entry.Id);
+        return instance;
+    }
+
+    /// <summary>
+    /// Records which model followed the previous one and returns the predicted next model if it
+    /// fits in the free budget. Called under the lock.
+    /// </summary>
+    private ModelEntry? RecordAccess(ModelEntry entry)
+    {
+        var previous = _lastAcquired;
+        _lastAcquired = entry;
+        if (previous != null && previous != entry)
+        {
+            previous.Successors.TryGetValue(entry, out var count);
+            previous.Successors[entry] = count + 1;
+        }
+
+        if (!EnablePrefetch || entry.Successors.Count == 0)
+            return null;
+
+        var next = entry.Successors.Aggregate((a, b) => b.Value > a.Value ? b : a).Key;
+        if (next.Instance != null || next.LoadTask != null)
+            return null;
+
+        return TryReserve(next, allowEviction: false, out _) ? next : null;
+    }
+
+    /// <summary>
+    /// Starts loading a model whose memory is reserved. Called under the lock.
+    /// </summary>
+    private void StartLoad(ModelEntry entry)
+    {
+        Log.ModelLoading(_logger, entry.Id, entry.MemoryBytes);
+        var load = LoadAsync(entry);
+        entry.LoadTask = load;
+
+        // A prefetch may have no waiter; its failure is already logged, so observe it here
+        load.ContinueWith(
+            static t => _ = t.Exception,
+            CancellationToken.None,
+            TaskContinuationOptions.OnlyOnFaulted | TaskContinuationOptions.ExecuteSynchronously,
+            TaskScheduler.Default);
+    }
+
+    private async Task LoadAsync(ModelEntry entry)
+    {
+        // Leave the caller's lock before loading on the thread pool
+        await Task.Yield();
+
+        IDisposable instance;
+        try
+        {
+            instance = entry.Factory();
+        }
+        catch (Exception ex)
+        {
+            Log.ModelLoadFailed(_logger, entry.Id, ex);
+            lock (_lock)
+            {
+                entry.LoadTask = null;
+                ReleaseReservation(entry);
+                SignalCapacity();
+            }
+            throw;
+        }
+
+        lock (_lock)
+        {
+            entry.LoadTask = null;
+            if (!_disposed)
+            {
+                entry.Instance = instance;
+                entry.LastUsed = ++_clock;
+                Interlocked.Increment(ref _loads);
+                return;
+            }
+        }
+
+        instance.Dispose();
+        throw new ObjectDisposedException(nameof(ModelManager));
+    }
+
+    private void DisposeEvicted(List<IDisposable>? evicted)
+    {
+        if (evicted == null)
+            return;
+
+        foreach (var instance in evicted)
+        {
+            instance.Dispose();
+        }
+    }
+
+    /// <summary>
+    /// Wakes callers waiting for memory. Called under the lock.
+    /// </summary>
+    private void SignalCapacity()
+    {
+        _capacityChanged.TrySetResult(true);
+        _capacityChanged = NewSignal();
+    }
+
+    private static TaskCompletionSource<bool> NewSignal() => new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+    private void ThrowIfDisposed()
+    {
+        if (_disposed)
+            throw new ObjectDisposedException(nameof(ModelManager));
+    }
+
+    /// <summary>
+    /// Unloads all models. Leases must not be used afterwards.
+    /// </summary>
+    public void Dispose()
+    {
+        List<IDisposable> instances;
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            instances = _entries.Values.Where(e => e.Instance != null).Select(e => e.Instance!).ToList();
+            foreach (var entry in _entries.Values)
+            {
+                entry.Instance = null;
+                entry.IsReserved = false;
+            }
+            _memoryInUse = 0;
+            _capacityChanged.TrySetResult(true);
+        }
+
+        foreach (var instance in instances)
+        {
+            instance.Dispose();
+        }
+    }
+}
+
+/// <summary>
+/// A registered model and its load state; guarded by the manager's lock
+/// </summary>
+internal sealed class ModelEntry
+{
+    public ModelEntry(string id, Type pipelineType, Func<IDisposable> factory, long memoryBytes)
+    {
+        Id = id;
+        PipelineType = pipelineType;
+        Factory = factory;
+        MemoryBytes = memoryBytes;
+    }
+
+    public string Id { get; }
+
+    public Type PipelineType { get; }
+
+    public Func<IDisposable> Factory { get; }
+
+    public long MemoryBytes { get; }
+
+    public IDisposable? Instance { get; set; }
+
+    public Task? LoadTask { get; set; }
+
+    /// <summary>
+    /// Whether the model's memory is counted in the manager's budget
+    /// </summary>
+    public bool IsReserved { get; set; }
+
+    public int RefCount { get; set; }
+
+    /// <summary>
+    /// Logical time of the last access, used for LRU ordering
+    /// </summary>
+    public long LastUsed { get; set; }
+
+    /// <summary>
+    /// How often each model was acquired right after this one
+    /// </summary>
+    public Dictionary<ModelEntry, int> Successors { get; } = new();
+}
+
+/// <summary>
+/// A reference to a loaded model; disposing the lease allows the model to be evicted
+/// </summary>
+/// <typeparam name="TPipeline">Pipeline type</typeparam>
+public sealed class ModelLease<TPipeline> : IDisposable where TPipeline : class, IDisposable
+{
+    private readonly ModelManager _manager;
+    private readonly ModelEntry _entry;
+    private int _released;
+
+    internal ModelLease(ModelManager manager, ModelEntry entry, TPipeline pipeline)
+    {
+        _manager = manager;
+        _entry = entry;
+        Pipeline = pipeline;
+    }
+
+    /// <summary>
+    /// Gets the model id
+    /// </summary>
+    public string ModelId => _entry.Id;
+
+    /// <summary>
+    /// Gets the pipeline
+    /// </summary>
+    public TPipeline Pipeline { get; }
+
+    /// <summary>
+    /// Releases the reference to the model
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.Exchange(ref _released, 1) == 0)
+        {
+            _manager.Release(_entry);
+        }
+    }
+}
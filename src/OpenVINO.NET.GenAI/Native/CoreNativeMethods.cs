@@ -0,0 +1,57 @@
+using System.Runtime.InteropServices;
+
+namespace Fluid.OpenVINO.GenAI.Native;
+
+/// <summary>
+/// P/Invoke declarations for the parts of the OpenVINO runtime C API used to query devices
+/// </summary>
+internal static class CoreNativeMethods
+{
+    private const string DllName = "openvino_c";
+
+    #region Core Methods
+
+    /// <summary>
+    /// Create an OpenVINO core
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_core_create([Out] out IntPtr core);
+
+    /// <summary>
+    /// Free an OpenVINO core
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern void ov_core_free(IntPtr core);
+
+    /// <summary>
+    /// Get the devices available for inference
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_core_get_available_devices(
+        IntPtr core,
+        [Out] out ov_available_devices_t devices);
+
+    /// <summary>
+    /// Free a device list returned by ov_core_get_available_devices
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern void ov_available_devices_free(ref ov_available_devices_t devices);
+
+    /// <summary>
+    /// Get a device property as a string; the value must be released with ov_free
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+    internal static extern ov_status_e ov_core_get_property(
+        IntPtr core,
+        [MarshalAs(UnmanagedType.LPStr)] string device_name,
+        [MarshalAs(UnmanagedType.LPStr)] string property_key,
+        [Out] out IntPtr property_value);
+
+    /// <summary>
+    /// Free a string allocated by the runtime
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern void ov_free(IntPtr content);
+
+    #endregion
+}
@@ -24,46 +24,31 @@ internal static class GenAINativeMethods
         [Out] out IntPtr pipe);
 
     /// <summary>
-    /// Create LLM pipeline with one property (2 args)
+    /// Create LLM pipeline with up to 8 properties. The native function is variadic and reads
+    /// only property_args_size arguments, so unused key/value slots are passed as null.
     /// </summary>
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, EntryPoint = "ov_genai_llm_pipeline_create")]
-    internal static extern ov_status_e ov_genai_llm_pipeline_create_with_1_property(
+    internal static extern ov_status_e ov_genai_llm_pipeline_create_with_properties(
         [MarshalAs(UnmanagedType.LPStr)] string models_path,
         [MarshalAs(UnmanagedType.LPStr)] string device,
         nuint property_args_size,
         [Out] out IntPtr pipe,
-        [MarshalAs(UnmanagedType.LPStr)] string prop1_key,
-        [MarshalAs(UnmanagedType.LPStr)] string prop1_value);
-
-    /// <summary>
-    /// Create LLM pipeline with two properties (4 args)
-    /// </summary>
-    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, EntryPoint = "ov_genai_llm_pipeline_create")]
-    internal static extern ov_status_e ov_genai_llm_pipeline_create_with_2_properties(
-        [MarshalAs(UnmanagedType.LPStr)] string models_path,
-        [MarshalAs(UnmanagedType.LPStr)] string device,
-        nuint property_args_size,
-        [Out] out IntPtr pipe,
-        [MarshalAs(UnmanagedType.LPStr)] string prop1_key,
-        [MarshalAs(UnmanagedType.LPStr)] string prop1_value,
-        [MarshalAs(UnmanagedType.LPStr)] string prop2_key,
-        [MarshalAs(UnmanagedType.LPStr)] string prop2_value);
-
-    /// <summary>
-    /// Create LLM pipeline with three properties (6 args)
-    /// </summary>
-    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, EntryPoint = "ov_genai_llm_pipeline_create")]
-    internal static extern ov_status_e ov_genai_llm_pipeline_create_with_3_properties(
-        [MarshalAs(UnmanagedType.LPStr)] string models_path,
-        [MarshalAs(UnmanagedType.LPStr)] string device,
-        nuint property_args_size,
-        [Out] out IntPtr pipe,
-        [MarshalAs(UnmanagedType.LPStr)] string prop1_key,
-        [MarshalAs(UnmanagedType.LPStr)] string prop1_value,
-        [MarshalAs(UnmanagedType.LPStr)] string prop2_key,
-        [MarshalAs(UnmanagedType.LPStr)] string prop2_value,
-        [MarshalAs(UnmanagedType.LPStr)] string prop3_key,
-        [MarshalAs(UnmanagedType.LPStr)] string prop3_value);
+        [MarshalAs(UnmanagedType.LPStr)] string? prop1_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop1_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop2_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop2_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop3_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop3_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop4_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop4_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop5_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop5_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop6_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop6_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop7_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop7_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop8_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop8_value);
 
     /// <summary>
     /// Free LLM pipeline
@@ -355,6 +340,20 @@ internal static class GenAINativeMethods
     internal static extern ov_status_e ov_genai_perf_metrics_get_throughput(
         IntPtr metrics, [Out] out float mean, [Out] out float std);
 
+    /// <summary>
+    /// Get inference duration
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_perf_metrics_get_inference_duration(
+        IntPtr metrics, [Out] out float mean, [Out] out float std);
+
+    /// <summary>
+    /// Get generate duration
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_perf_metrics_get_generate_duration(
+        IntPtr metrics, [Out] out float mean, [Out] out float std);
+
     #endregion
 
     #region Whisper Pipeline Methods
@@ -369,6 +368,33 @@ internal static class GenAINativeMethods
         nuint property_args_size,
         [Out] out IntPtr pipeline);
 
+    /// <summary>
+    /// Create Whisper pipeline with up to 8 properties. The native function is variadic and reads
+    /// only property_args_size arguments, so unused key/value slots are passed as null.
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi, EntryPoint = "ov_genai_whisper_pipeline_create")]
+    internal static extern ov_status_e ov_genai_whisper_pipeline_create_with_properties(
+        [MarshalAs(UnmanagedType.LPStr)] string models_path,
+        [MarshalAs(UnmanagedType.LPStr)] string device,
+        nuint property_args_size,
+        [Out] out IntPtr pipeline,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop1_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop1_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop2_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop2_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop3_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop3_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop4_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop4_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop5_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop5_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop6_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop6_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop7_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop7_value,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop8_key,
+        [MarshalAs(UnmanagedType.LPStr)] string? prop8_value);
+
     /// <summary>
     /// Free Whisper pipeline
     /// </summary>
@@ -386,6 +412,18 @@ internal static class GenAINativeMethods
         IntPtr config,
         [Out] out IntPtr results);
 
+    /// <summary>
+    /// Generate results from raw speech input passed as a pointer, so slices of a
+    /// larger buffer can be transcribed without copying
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, EntryPoint = "ov_genai_whisper_pipeline_generate")]
+    internal static extern ov_status_e ov_genai_whisper_pipeline_generate_from_pointer(
+        IntPtr pipeline,
+        IntPtr raw_speech,
+        nuint raw_speech_size,
+        IntPtr config,
+        [Out] out IntPtr results);
+
     /// <summary>
     /// Get generation config from Whisper pipeline
     /// </summary>
@@ -427,6 +465,15 @@ internal static class GenAINativeMethods
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     internal static extern void ov_genai_whisper_generation_config_free(IntPtr config);
 
+    /// <summary>
+    /// Get the base generation config of a Whisper generation config. The returned
+    /// handle must be freed but shares state with the Whisper config.
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_whisper_generation_config_get_generation_config(
+        IntPtr config,
+        [Out] out IntPtr generation_config);
+
     /// <summary>
     /// Set language
     /// </summary>
@@ -467,6 +514,48 @@ internal static class GenAINativeMethods
         IntPtr config,
         [MarshalAs(UnmanagedType.LPStr)] string hotwords);
 
+    /// <summary>
+    /// Get return timestamps flag
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_whisper_generation_config_get_return_timestamps(
+        IntPtr config,
+        [Out, MarshalAs(UnmanagedType.I1)] out bool return_timestamps);
+
+    /// <summary>
+    /// Set tokens suppressed at every decoding step
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_whisper_generation_config_set_suppress_tokens(
+        IntPtr config,
+        [MarshalAs(UnmanagedType.LPArray)] long[] tokens,
+        nuint tokens_count);
+
+    /// <summary>
+    /// Set tokens suppressed at the first decoding step
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_whisper_generation_config_set_begin_suppress_tokens(
+        IntPtr config,
+        [MarshalAs(UnmanagedType.LPArray)] long[] tokens,
+        nuint tokens_count);
+
+    /// <summary>
+    /// Set maximum initial timestamp index
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_whisper_generation_config_set_max_initial_timestamp_index(
+        IntPtr config,
+        nuint index);
+
+    /// <summary>
+    /// Get maximum initial timestamp index
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    internal static extern ov_status_e ov_genai_whisper_generation_config_get_max_initial_timestamp_index(
+        IntPtr config,
+        [Out] out nuint index);
+
     /// <summary>
     /// Validate Whisper generation config
     /// </summary>
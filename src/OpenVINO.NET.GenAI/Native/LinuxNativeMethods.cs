@@ -0,0 +1,27 @@
+using System.Runtime.InteropServices;
+
+namespace Fluid.OpenVINO.GenAI.Native;
+
+/// <summary>
+/// P/Invoke declarations for Linux scheduler functions used to place threads on CPUs
+/// </summary>
+internal static class LinuxNativeMethods
+{
+    private const string DllName = "libc.so.6";
+
+    #region Scheduler Methods
+
+    /// <summary>
+    /// Get the CPU affinity mask of a thread; pid 0 is the calling thread
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, SetLastError = true)]
+    internal static extern int sched_getaffinity(int pid, nuint cpusetsize, [Out] ulong[] mask);
+
+    /// <summary>
+    /// Set the CPU affinity mask of a thread; pid 0 is the calling thread
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, SetLastError = true)]
+    internal static extern int sched_setaffinity(int pid, nuint cpusetsize, [In] ulong[] mask);
+
+    #endregion
+}
@@ -1,5 +1,8 @@
 using System.Reflection;
 using System.Runtime.InteropServices;
+using Fluid.OpenVINO.GenAI.Logging;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Abstractions;
 
 namespace Fluid.OpenVINO.GenAI.Native;
 
@@ -12,6 +15,7 @@ internal static class NativeLibraryLoader
     private static readonly object _lock = new();
     private static readonly List<string> _searchPaths = new();
     private static readonly List<string> _loadedLibraries = new();
+    private static ILogger _logger = NullLogger.Instance;
 
     [DllImport("kernel32.dll", CharSet = CharSet.Auto, SetLastError = true)]
     private static extern bool SetDllDirectory(string lpPathName);
@@ -29,6 +33,8 @@ internal static class NativeLibraryLoader
             if (_isInitialized)
                 return;
 
+            _logger = GenAILogging.CreateLogger(typeof(NativeLibraryLoader).FullName!);
+
             try
             {
                 if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
@@ -84,10 +90,10 @@ internal static class NativeLibraryLoader
 
         if (dllDir != null)
         {
-            Console.WriteLine($"Setting DLL directory to: {dllDir}");
+            Log.SettingDllDirectory(_logger, dllDir);
             if (!SetDllDirectory(dllDir))
             {
-                Console.WriteLine($"Warning: Failed to set DLL directory to {dllDir}");
+                Log.SetDllDirectoryFailed(_logger, dllDir);
             }
         }
 
@@ -108,7 +114,7 @@ internal static class NativeLibraryLoader
 
         // First priority: Check OPENVINO_RUNTIME_PATH environment variable
         var envPath = Environment.GetEnvironmentVariable("OPENVINO_RUNTIME_PATH");
-        Console.WriteLine($"OPENVINO_RUNTIME_PATH: {envPath}");
+        Log.RuntimePath(_logger, envPath);
         if (!string.IsNullOrEmpty(envPath) && Directory.Exists(envPath))
         {
             AddSearchPathsRecursively(envPath);
@@ -159,7 +165,7 @@ internal static class NativeLibraryLoader
         catch (Exception ex)
         {
             // Log but don't fail - recursive search is best-effort
-            Console.WriteLine($"Warning: Could not search subdirectories of {basePath}: {ex.Message}");
+            Log.SubdirectorySearchFailed(_logger, basePath, ex);
         }
     }
 
@@ -222,11 +228,12 @@ internal static class NativeLibraryLoader
         {
             handle = NativeLibrary.Load(path);
             _loadedLibraries.Add(path);
+            Log.LibraryLoaded(_logger, path);
             return true;
         }
         catch (Exception ex)
         {
-            Console.WriteLine($"Failed to load {path}: {ex.Message}");
+            Log.LibraryLoadFailed(_logger, path, ex);
             return false;
         }
     }
@@ -311,7 +318,7 @@ internal static class NativeLibraryLoader
             catch (Exception ex)
             {
                 // Log dependency loading attempts - some might be optional
-                System.Diagnostics.Debug.WriteLine($"Could not preload dependency {dependency}: {ex.Message}");
+                Log.PreloadFailed(_logger, dependency, ex);
             }
         }
     }
@@ -341,7 +348,7 @@ internal static class NativeLibraryLoader
             catch (Exception ex)
             {
                 // Log dependency loading attempts - some might be optional
-                Console.WriteLine($"Could not preload dependency {dependency}: {ex.Message}");
+                Log.PreloadFailed(_logger, dependency, ex);
             }
         }
     }
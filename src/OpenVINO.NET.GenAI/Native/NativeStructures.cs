@@ -54,6 +54,15 @@ public delegate ov_genai_streamming_status_e StreamerCallbackFunc(
     [MarshalAs(UnmanagedType.LPStr)] string str,
     IntPtr args);
 
+/// <summary>
+/// Callback function delegate for streaming generation that receives the token's UTF-8 bytes unmarshaled
+/// </summary>
+/// <param name="str">Null-terminated UTF-8 token text</param>
+/// <param name="args">User-defined arguments</param>
+/// <returns>Streaming status</returns>
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+public delegate ov_genai_streamming_status_e StreamerCallbackUtf8Func(IntPtr str, IntPtr args);
+
 /// <summary>
 /// Streamer callback structure
 /// </summary>
@@ -63,3 +72,13 @@ public struct streamer_callback
     public IntPtr callback_func;
     public IntPtr args;
 }
+
+/// <summary>
+/// List of available device names
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct ov_available_devices_t
+{
+    public IntPtr devices;
+    public nuint size;
+}
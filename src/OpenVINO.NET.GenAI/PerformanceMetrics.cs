@@ -99,6 +99,30 @@ public sealed class PerformanceMetrics : IDisposable
         return (mean, std);
     }
 
+    /// <summary>
+    /// Gets the model inference duration statistics
+    /// </summary>
+    /// <returns>A tuple containing (mean, standard deviation) in milliseconds</returns>
+    public (float Mean, float Std) GetInferenceDuration()
+    {
+        ThrowIfDisposed();
+        var status = GenAINativeMethods.ov_genai_perf_metrics_get_inference_duration(_handle.DangerousGetHandle(), out var mean, out var std);
+        OpenVINOGenAIException.ThrowIfError(status, "get inference duration");
+        return (mean, std);
+    }
+
+    /// <summary>
+    /// Gets the end-to-end generate call duration statistics
+    /// </summary>
+    /// <returns>A tuple containing (mean, standard deviation) in milliseconds</returns>
+    public (float Mean, float Std) GetGenerateDuration()
+    {
+        ThrowIfDisposed();
+        var status = GenAINativeMethods.ov_genai_perf_metrics_get_generate_duration(_handle.DangerousGetHandle(), out var mean, out var std);
+        OpenVINOGenAIException.ThrowIfError(status, "get generate duration");
+        return (mean, std);
+    }
+
     /// <summary>
     /// Gets the average tokens per second
     /// </summary>
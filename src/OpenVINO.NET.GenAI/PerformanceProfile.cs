@@ -0,0 +1,381 @@
+using System.Diagnostics;
+using System.Globalization;
+using Fluid.OpenVINO.GenAI.Exceptions;
+using Fluid.OpenVINO.GenAI.Logging;
+using Fluid.OpenVINO.GenAI.Native;
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// A named set of performance settings: performance hint, streams, threads, KV cache precision
+/// and the number of pipeline replicas to pool
+/// </summary>
+/// <remarks>
+/// A generation pipeline runs one request at a time, so throughput comes from pooling several
+/// replicas that split the cores, not from extra streams inside one replica. Use the presets,
+/// construct custom settings, or measure the best settings for a model with <see cref="AutoTuneAsync"/>.
+/// </remarks>
+public sealed class PerformanceProfile
+{
+    private const string DefaultStoreFileName = "performance-profiles.json";
+
+    /// <summary>
+    /// Initializes a new instance of the PerformanceProfile class
+    /// </summary>
+    /// <param name="name">Profile name</param>
+    /// <param name="hint">Performance hint</param>
+    /// <param name="poolSize">Number of pipeline replicas</param>
+    /// <param name="numStreams">Inference streams per replica, or null for the hint's default</param>
+    /// <param name="inferenceNumThreads">Inference threads per replica, or null for the hint's default</param>
+    /// <param name="kvCachePrecision">KV cache precision, or null for the device default</param>
+    public PerformanceProfile(
+        string name,
+        PerformanceHint hint,
+        int poolSize = 1,
+        int? numStreams = null,
+        int? inferenceNumThreads = null,
+        KVCachePrecision? kvCachePrecision = null)
+    {
+        if (string.IsNullOrWhiteSpace(name))
+            throw new ArgumentException("Profile name cannot be null or empty", nameof(name));
+        if (poolSize <= 0)
+            throw new ArgumentOutOfRangeException(nameof(poolSize), "Pool size must be positive");
+        if (numStreams <= 0)
+            throw new ArgumentOutOfRangeException(nameof(numStreams), "Number of streams must be positive");
+        if (inferenceNumThreads <= 0)
+            throw new ArgumentOutOfRangeException(nameof(inferenceNumThreads), "Number of threads must be positive");
+
+        Name = name;
+        Hint = hint;
+        PoolSize = poolSize;
+        NumStreams = numStreams;
+        InferenceNumThreads = inferenceNumThreads;
+        KVCachePrecision = kvCachePrecision;
+    }
+
+    /// <summary>
+    /// Interactive use: one replica with every core working on each request
+    /// </summary>
+    public static PerformanceProfile Latency { get; } = new("latency", PerformanceHint.Latency, numStreams: 1);
+
+    /// <summary>
+    /// Mixed use: two replicas on hosts with at least 8 cores, each with half of them, and a compact KV cache
+    /// </summary>
+    public static PerformanceProfile Balanced { get; } = CreateBalanced();
+
+    /// <summary>
+    /// Offline and batch use: one replica per 4 cores and a compact KV cache, so many requests run at once
+    /// </summary>
+    public static PerformanceProfile Throughput { get; } = CreateThroughput();
+
+    /// <summary>
+    /// Gets the profile name
+    /// </summary>
+    public string Name { get; }
+
+    /// <summary>
+    /// Gets the performance hint
+    /// </summary>
+    public PerformanceHint Hint { get; }
+
+    /// <summary>
+    /// Gets the number of pipeline replicas
+    /// </summary>
+    public int PoolSize { get; }
+
+    /// <summary>
+    /// Gets the inference streams per replica, or null for the hint's default
+    /// </summary>
+    public int? NumStreams { get; }
+
+    /// <summary>
+    /// Gets the inference threads per replica, or null for the hint's default
+    /// </summary>
+    public int? InferenceNumThreads { get; }
+
+    /// <summary>
+    /// Gets the KV cache precision, or null for the device default
+    /// </summary>
+    public KVCachePrecision? KVCachePrecision { get; }
+
+    /// <summary>
+    /// Creates pipeline properties that apply this profile
+    /// </summary>
+    /// <param name="properties">Properties to extend (optional); not modified</param>
+    /// <returns>The properties</returns>
+    public PipelineProperties CreateProperties(PipelineProperties? properties = null)
+    {
+        var result = properties?.Clone() ?? new PipelineProperties();
+        result.WithPerformanceHint(Hint);
+        if (NumStreams.HasValue)
+            result.WithNumStreams(NumStreams.Value);
+        if (InferenceNumThreads.HasValue)
+            result.WithInferenceNumThreads(InferenceNumThreads.Value);
+        if (KVCachePrecision.HasValue)
+            result.WithKVCachePrecision(KVCachePrecision.Value);
+
+        return result;
+    }
+
+    /// <summary>
+    /// Creates a pool of LLM pipelines with this profile
+    /// </summary>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="device">Device to run on</param>
+    /// <param name="properties">Additional properties (optional)</param>
+    /// <returns>A pool of <see cref="PoolSize"/> replicas</returns>
+    public PipelinePool<LLMPipeline> CreateLLMPool(string modelPath, string device = "CPU", PipelineProperties? properties = null)
+    {
+        var profileProperties = CreateProperties(properties);
+        return new PipelinePool<LLMPipeline>(() => new LLMPipeline(modelPath, device, profileProperties), PoolSize);
+    }
+
+    /// <summary>
+    /// Creates a pool of Whisper pipelines with this profile
+    /// </summary>
+    /// <param name="modelPath">Path to the Whisper model directory</param>
+    /// <param name="device">Device to run on</param>
+    /// <param name="properties">Additional properties (optional)</param>
+    /// <returns>A pool of <see cref="PoolSize"/> replicas</returns>
+    public PipelinePool<WhisperPipeline> CreateWhisperPool(string modelPath, string device = "CPU", PipelineProperties? properties = null)
+    {
+        var profileProperties = CreateProperties(properties);
+        return new PipelinePool<WhisperPipeline>(() => new WhisperPipeline(modelPath, device, profileProperties), PoolSize);
+    }
+
+    /// <summary>
+    /// Measures candidate settings for an LLM on this machine and returns the best, reusing a stored result when one matches
+    /// </summary>
+    /// <remarks>
+    /// For <see cref="PerformanceHint.Latency"/> the candidates vary thread count and KV cache
+    /// precision of a single replica and are ranked by <see cref="WorkloadProfile.EstimateLatency"/>.
+    /// For throughput they also vary the pool size, limited by the memory of the host, and are
+    /// ranked by generated tokens per second with every replica busy. Results are stored per
+    /// model, host, device, objective and workload.
+    /// </remarks>
+    /// <param name="modelPath">Path to the model directory</param>
+    /// <param name="objective">What to optimize: <see cref="PerformanceHint.Latency"/> or throughput</param>
+    /// <param name="device">Device to run on</param>
+    /// <param name="workload">Expected workload, or null for <see cref="WorkloadProfile.Chat"/></param>
+    /// <param name="storePath">File where results are stored, or null for the default under local application data</param>
+    /// <param name="refresh">True to measure again even if a stored result matches</param>
+    /// <param name="cancellationToken">Cancellation token checked between candidates</param>
+    /// <returns>The best profile</returns>
+    public static async Task<PerformanceProfile> AutoTuneAsync(
+        string modelPath,
+        PerformanceHint objective = PerformanceHint.Latency,
+        string device = "CPU",
+        WorkloadProfile? workload = null,
+        string? storePath = null,
+        bool refresh = false,
+        CancellationToken cancellationToken = default)
+    {
+        if (string.IsNullOrEmpty(modelPath))
+            throw new ArgumentException("Model path cannot be null or empty", nameof(modelPath));
+        if (!Directory.Exists(modelPath))
+            throw new DirectoryNotFoundException($"Model directory not found: {modelPath}");
+        if (string.IsNullOrEmpty(device))
+            throw new ArgumentException("Device cannot be null or empty", nameof(device));
+
+        workload ??= WorkloadProfile.Chat;
+        var logger = GenAILogging.CreateLogger<PerformanceProfile>();
+        var store = new TuningStore<StoredProfile>(storePath ?? TuningStore<StoredProfile>.GetDefaultPath(DefaultStoreFileName), logger);
+        var key = new TuningKey(modelPath)
+            .Add("device", device)
+            .Add("objective", objective.ToString())
+            .Add("workload", $"{workload.Name}:{workload.PromptWords}:{workload.OutputTokens}")
+            .ToString();
+
+        if (!refresh)
+        {
+            var stored = await store.ReadAsync(key, cancellationToken).ConfigureAwait(false);
+            if (stored != null)
+            {
+                var cached = stored.ToProfile();
+                Log.ProfileTuned(logger, cached.ToString(), modelPath, true);
+                return cached;
+            }
+        }
+
+        PerformanceProfile? best = null;
+        var bestScore = double.NaN;
+        Exception? lastError = null;
+        foreach (var candidate in GetTuningCandidates(objective, ModelManager.EstimateMemory(modelPath)))
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+            try
+            {
+                var score = objective == PerformanceHint.Latency
+                    ? await LLMBenchmark.RunCandidateAsync(() => MeasureLatency(candidate, modelPath, device, workload), cancellationToken).ConfigureAwait(false)
+                    : await LLMBenchmark.RunCandidateAsync(() => MeasureThroughputAsync(candidate, modelPath, device, workload), cancellationToken).ConfigureAwait(false);
+                Log.ProfileMeasured(logger, candidate.ToString(), score);
+
+                // Latency is minimized, throughput maximized
+                var better = objective == PerformanceHint.Latency ? score < bestScore : score > bestScore;
+                if (best == null || better)
+                {
+                    best = candidate;
+                    bestScore = score;
+                }
+            }
+            catch (Exception ex) when (ex is OpenVINOGenAIException or IOException or OutOfMemoryException)
+            {
+                lastError = ex;
+                Log.ProfileFailed(logger, candidate.ToString(), ex);
+            }
+        }
+
+        if (best == null)
+            throw new OpenVINOGenAIException(ov_status_e.GENERAL_ERROR, $"No candidate settings could run the model at {modelPath}", lastError!);
+
+        var tuned = new PerformanceProfile(
+            $"tuned-{objective.ToString().ToLowerInvariant()}",
+            best.Hint,
+            best.PoolSize,
+            best.NumStreams,
+            best.InferenceNumThreads,
+            best.KVCachePrecision);
+
+        await store.WriteAsync(key, StoredProfile.FromProfile(tuned, bestScore), cancellationToken).ConfigureAwait(false);
+        Log.ProfileTuned(logger, tuned.ToString(), modelPath, false);
+        return tuned;
+    }
+
+    /// <inheritdoc/>
+    public override string ToString()
+    {
+        var threads = InferenceNumThreads?.ToString(CultureInfo.InvariantCulture) ?? "default";
+        var kv = KVCachePrecision?.ToString() ?? "default";
+        return $"{Name} ({Hint}, {PoolSize} replica(s), {NumStreams?.ToString(CultureInfo.InvariantCulture) ?? "default"} stream(s), {threads} thread(s), KV {kv})";
+    }
+
+    private static PerformanceProfile CreateBalanced()
+    {
+        var cores = Environment.ProcessorCount;
+        var poolSize = cores >= 8 ? 2 : 1;
+        return new PerformanceProfile(
+            "balanced",
+            PerformanceHint.Latency,
+            poolSize,
+            numStreams: 1,
+            inferenceNumThreads: poolSize > 1 ? cores / poolSize : null,
+            kvCachePrecision: GenAI.KVCachePrecision.U8);
+    }
+
+    private static PerformanceProfile CreateThroughput()
+    {
+        var cores = Environment.ProcessorCount;
+        var poolSize = Math.Max(1, cores / 4);
+
+        // The hint chooses the streams for each replica's threads; forcing one stream would undo it
+        return new PerformanceProfile(
+            "throughput",
+            PerformanceHint.Throughput,
+            poolSize,
+            inferenceNumThreads: Math.Max(1, cores / poolSize),
+            kvCachePrecision: GenAI.KVCachePrecision.U8);
+    }
+
+    private static IEnumerable<PerformanceProfile> GetTuningCandidates(PerformanceHint objective, long modelBytes)
+    {
+        var cores = Environment.ProcessorCount;
+        var kvPrecisions = new KVCachePrecision?[] { null, GenAI.KVCachePrecision.U8 };
+
+        if (objective == PerformanceHint.Latency)
+        {
+            // Using every logical core helps some CPUs and hurts others through hyper-thread contention
+            var threadCounts = cores >= 4 ? new int?[] { null, cores / 2 } : new int?[] { null };
+            foreach (var threads in threadCounts)
+            {
+                foreach (var kv in kvPrecisions)
+                {
+                    yield return new PerformanceProfile("candidate", PerformanceHint.Latency, 1, 1, threads, kv);
+                }
+            }
+            yield break;
+        }
+
+        // Keep weights, caches and activations of all replicas within most of the physical memory
+        var memoryBytes = GC.GetGCMemoryInfo().TotalAvailableMemoryBytes;
+        for (int poolSize = 1; poolSize <= Math.Max(1, cores / 2); poolSize *= 2)
+        {
+            if (poolSize > 1 && modelBytes > 0 && memoryBytes > 0 && modelBytes * 2 * poolSize > memoryBytes * 8 / 10)
+                break;
+
+            foreach (var kv in kvPrecisions)
+            {
+                yield return new PerformanceProfile("candidate", PerformanceHint.Throughput, poolSize, null, Math.Max(1, cores / poolSize), kv);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Returns the estimated request latency in milliseconds
+    /// </summary>
+    private static double MeasureLatency(PerformanceProfile candidate, string modelPath, string device, WorkloadProfile workload)
+    {
+        using var pipeline = new LLMPipeline(modelPath, device, candidate.CreateProperties());
+        var (ttft, tpot, _) = LLMBenchmark.MeasureLatency(pipeline, workload, iterations: 1);
+        return workload.EstimateLatency(ttft, tpot);
+    }
+
+    /// <summary>
+    /// Returns generated tokens per second with every replica busy
+    /// </summary>
+    private static async Task<double> MeasureThroughputAsync(PerformanceProfile candidate, string modelPath, string device, WorkloadProfile workload)
+    {
+        using var pool = candidate.CreateLLMPool(modelPath, device);
+        using var config = GenerationConfig.Default.WithMaxTokens(workload.BenchmarkTokens);
+        var prompt = workload.CreatePrompt();
+
+        foreach (var replica in pool.Replicas)
+        {
+            LLMBenchmark.WarmUp(replica, prompt, config);
+        }
+
+        var stopwatch = Stopwatch.StartNew();
+        var requests = Enumerable.Range(0, pool.Size * 2).Select(async _ =>
+        {
+            using var lease = await pool.RentAsync().ConfigureAwait(false);
+            using var result = await lease.Pipeline.GenerateAsync(prompt, config).ConfigureAwait(false);
+            return result.PerformanceMetrics.NumGenerationTokens;
+        });
+        var tokens = (await Task.WhenAll(requests).ConfigureAwait(false)).Sum();
+
+        return tokens / stopwatch.Elapsed.TotalSeconds;
+    }
+
+    private sealed class StoredProfile
+    {
+        public PerformanceHint Hint { get; set; }
+
+        public int PoolSize { get; set; } = 1;
+
+        public int? NumStreams { get; set; }
+
+        public int? InferenceNumThreads { get; set; }
+
+        public KVCachePrecision? KVCachePrecision { get; set; }
+
+        public string Name { get; set; } = string.Empty;
+
+        public double Score { get; set; }
+
+        public DateTimeOffset MeasuredAt { get; set; }
+
+        public static StoredProfile FromProfile(PerformanceProfile profile, double score) => new()
+        {
+            Name = profile.Name,
+            Hint = profile.Hint,
+            PoolSize = profile.PoolSize,
+            NumStreams = profile.NumStreams,
+            InferenceNumThreads = profile.InferenceNumThreads,
+            KVCachePrecision = profile.KVCachePrecision,
+            Score = score,
+            MeasuredAt = DateTimeOffset.UtcNow
+        };
+
+        public PerformanceProfile ToProfile() => new(Name, Hint, PoolSize, NumStreams, InferenceNumThreads, KVCachePrecision);
+    }
+}
@@ -0,0 +1,274 @@
+using System.Runtime.InteropServices;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Guards a native pipeline handle: serializes calls, holds a handle reference for the duration
+/// of each call, and lets disposal cancel and wait for the calls in flight
+/// </summary>
+/// <remarks>
+/// The handle is only released once every call has returned, so a call that outlives
+/// <see cref="Close"/> still runs against a live pipeline. A call may enter the gate again on
+/// the thread that holds it, e.g. to read the configuration during a transcription; the nested
+/// call shares the outer call's turn and handle reference.
+/// </remarks>
+internal sealed class PipelineGate
+{
+    // Long enough for a transcription window or a short generation
+    private static readonly TimeSpan DrainTimeout = TimeSpan.FromSeconds(30);
+
+    // The gate whose call is running on this thread
+    [ThreadStatic]
+    private static PipelineGate? _held;
+
+    private readonly SafeHandle _handle;
+    private readonly string _owner;
+    private readonly SemaphoreSlim _calls = new(1, 1);
+    private readonly object _state = new();
+    private readonly CancellationTokenSource _closing = new();
+    private int _active;
+    private bool _closed;
+    private bool _canceled;
+
+    public PipelineGate(SafeHandle handle, string owner)
+    {
+        _handle = handle;
+        _owner = owner;
+    }
+
+    /// <summary>
+    /// Gets the number of calls running or waiting for the pipeline
+    /// </summary>
+    public int ActiveCalls => Volatile.Read(ref _active);
+
+    /// <summary>
+    /// Gets a token that is canceled when the pipeline is disposed; read it only during a call
+    /// </summary>
+    public CancellationToken Closing => _closing.Token;
+
+    /// <summary>
+    /// Waits for the pipeline and holds it on this thread until the returned call is disposed
+    /// </summary>
+    /// <exception cref="ObjectDisposedException">The pipeline was disposed</exception>
+    public Call Enter()
+    {
+        if (_held == this)
+        {
+            // Nested calls fail once the pipeline is disposed, e.g. before a transcription's next window
+            if (Volatile.Read(ref _closed))
+                throw new ObjectDisposedException(_owner);
+            return new Call(this, CallKind.Nested, null);
+        }
+
+        Admit();
+        try
+        {
+            _calls.Wait();
+        }
+        catch
+        {
+            Leave();
+            throw;
+        }
+
+        Acquire();
+        var previous = _held;
+        _held = this;
+        return new Call(this, CallKind.Bound, previous);
+    }
+
+    /// <summary>
+    /// Waits for the pipeline without blocking a thread, then runs a blocking call on the scheduler
+    /// while holding it
+    /// </summary>
+    /// <remarks>
+    /// Waiting here rather than on the scheduler keeps calls queued for a busy pipeline from
+    /// occupying inference threads that other pipelines share.
+    /// </remarks>
+    /// <exception cref="ObjectDisposedException">The pipeline was disposed</exception>
+    public async Task<T> RunAsync<T>(TaskScheduler scheduler, Func<T> work, CancellationToken cancellationToken)
+    {
+        using var call = await EnterAsync(cancellationToken).ConfigureAwait(false);
+        return await InferenceScheduler.Run(scheduler, () =>
+        {
+            var previous = _held;
+            _held = this;
+            try
+            {
+                return work();
+            }
+            finally
+            {
+                _held = previous;
+            }
+        }, cancellationToken).ConfigureAwait(false);
+    }
+
+    /// <inheritdoc cref="RunAsync{T}(TaskScheduler, Func{T}, CancellationToken)"/>
+    public Task RunAsync(TaskScheduler scheduler, Action work, CancellationToken cancellationToken)
+        => RunAsync(scheduler, () =>
+        {
+            work();
+            return true;
+        }, cancellationToken);
+
+    /// <summary>
+    /// Rejects new calls, cancels the running ones and waits for them before releasing the handle
+    /// </summary>
+    /// <returns>The number of calls still running when the wait gave up</returns>
+    public int Close()
+    {
+        lock (_state)
+        {
+            if (_closed)
+                return 0;
+            _closed = true;
+        }
+
+        _closing.Cancel();
+        lock (_state)
+        {
+            _canceled = true;
+        }
+
+        // A call disposing its own pipeline can't wait for itself; its reference keeps the handle alive
+        if (_held != this)
+        {
+            var deadline = Environment.TickCount64 + (long)DrainTimeout.TotalMilliseconds;
+            lock (_state)
+            {
+                while (_active > 0)
+                {
+                    var remaining = deadline - Environment.TickCount64;
+                    if (remaining <= 0 || !Monitor.Wait(_state, (int)remaining))
+                        break;
+                }
+            }
+        }
+
+        _handle.Dispose();
+
+        lock (_state)
+        {
+            if (_active == 0)
+                _closing.Dispose();
+            return _active;
+        }
+    }
+
+    private async Task<Call> EnterAsync(CancellationToken cancellationToken)
+    {
+        Admit();
+        try
+        {
+            await _calls.WaitAsync(cancellationToken).ConfigureAwait(false);
+        }
+        catch
+        {
+            Leave();
+            throw;
+        }
+
+        Acquire();
+        return new Call(this, CallKind.Unbound, null);
+    }
+
+    private void Admit()
+    {
+        lock (_state)
+        {
+            if (_closed)
+                throw new ObjectDisposedException(_owner);
+            _active++;
+        }
+    }
+
+    /// <summary>
+    /// Takes a handle reference once the pipeline is free
+    /// </summary>
+    private void Acquire()
+    {
+        var added = false;
+        try
+        {
+            // Calls queued behind a disposal fail instead of running to completion
+            if (Volatile.Read(ref _closed))
+                throw new ObjectDisposedException(_owner);
+            _handle.DangerousAddRef(ref added);
+        }
+        catch
+        {
+            if (added)
+                _handle.DangerousRelease();
+            _calls.Release();
+            Leave();
+            throw;
+        }
+    }
+
+    private void Exit()
+    {
+        _calls.Release();
+        _handle.DangerousRelease();
+        Leave();
+    }
+
+    private void Leave()
+    {
+        lock (_state)
+        {
+            if (--_active == 0)
+            {
+                Monitor.PulseAll(_state);
+
+                // The last call out of a closed pipeline releases the token
+                if (_canceled)
+                    _closing.Dispose();
+            }
+        }
+    }
+
+    internal enum CallKind
+    {
+        // Holds the pipeline on the thread that entered
+        Bound,
+
+        // Holds the pipeline for an async caller; RunAsync holds it on the inference thread
+        Unbound,
+
+        // Shares the turn of a call this thread already holds
+        Nested
+    }
+
+    /// <summary>
+    /// A call holding the pipeline
+    /// </summary>
+    public readonly struct Call : IDisposable
+    {
+        private readonly PipelineGate _gate;
+        private readonly CallKind _kind;
+        private readonly PipelineGate? _previous;
+
+        internal Call(PipelineGate gate, CallKind kind, PipelineGate? previous)
+        {
+            _gate = gate;
+            _kind = kind;
+            _previous = previous;
+        }
+
+        /// <summary>
+        /// Gets the native pipeline handle, valid until the call is disposed
+        /// </summary>
+        public IntPtr Handle => _gate._handle.DangerousGetHandle();
+
+        public void Dispose()
+        {
+            if (_kind == CallKind.Nested)
+                return;
+
+            if (_kind == CallKind.Bound)
+                _held = _previous;
+            _gate.Exit();
+        }
+    }
+}
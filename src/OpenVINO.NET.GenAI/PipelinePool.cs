@@ -0,0 +1,248 @@
+using System.Threading.Channels;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// A fixed-size pool of pipeline replicas. Each replica serves one caller at a time.
+/// </summary>
+/// <typeparam name="TPipeline">Pipeline type, e.g. <see cref="LLMPipeline"/> or <see cref="WhisperPipeline"/></typeparam>
+public sealed class PipelinePool<TPipeline> : IDisposable where TPipeline : class, IDisposable
+{
+    private readonly TPipeline[] _replicas;
+    private readonly Channel<TPipeline> _idle;
+    private readonly bool _ownsReplicas;
+    private int _waiting;
+    private bool _disposed;
+
+    /// <summary>
+    /// Initializes a new instance of the PipelinePool class, creating replicas with a factory
+    /// </summary>
+    /// <param name="factory">Factory that creates one replica</param>
+    /// <param name="size">Number of replicas</param>
+    public PipelinePool(Func<TPipeline> factory, int size)
+    {
+        if (factory == null)
+            throw new ArgumentNullException(nameof(factory));
+        if (size <= 0)
+            throw new ArgumentOutOfRangeException(nameof(size), "Pool size must be positive");
+
+        var replicas = new List<TPipeline>(size);
+        try
+        {
+            for (int i = 0; i < size; i++)
+            {
+                replicas.Add(factory());
+            }
+        }
+        catch
+        {
+            foreach (var replica in replicas)
+            {
+                replica.Dispose();
+            }
+            throw;
+        }
+
+        _replicas = replicas.ToArray();
+        _ownsReplicas = true;
+        _idle = CreateIdleChannel(_replicas);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the PipelinePool class with one replica per placement
+    /// </summary>
+    /// <remarks>
+    /// Use <see cref="ReplicaPlacement.Partition(int)"/> to spread replicas across the NUMA
+    /// nodes of the host so each one decodes from node-local memory.
+    /// </remarks>
+    /// <param name="factory">Factory that creates the replica for a placement</param>
+    /// <param name="placements">Placement of each replica</param>
+    public PipelinePool(Func<ReplicaPlacement, TPipeline> factory, IReadOnlyList<ReplicaPlacement> placements)
+        : this(CreatePlacedFactory(factory, placements), placements?.Count ?? 0)
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the PipelinePool class from existing replicas
+    /// </summary>
+    /// <param name="replicas">The replicas to pool</param>
+    /// <param name="ownsReplicas">Whether disposing the pool disposes the replicas</param>
+    public PipelinePool(IEnumerable<TPipeline> replicas, bool ownsReplicas = true)
+    {
+        if (replicas == null)
+            throw new ArgumentNullException(nameof(replicas));
+
+        _replicas = replicas.ToArray();
+        if (_replicas.Length == 0)
+            throw new ArgumentException("Pool requires at least one replica", nameof(replicas));
+
+        _ownsReplicas = ownsReplicas;
+        _idle = CreateIdleChannel(_replicas);
+    }
+
+    /// <summary>
+    /// Gets the number of replicas in the pool
+    /// </summary>
+    public int Size => _replicas.Length;
+
+    /// <summary>
+    /// Gets the number of idle replicas
+    /// </summary>
+    public int Available => _idle.Reader.Count;
+
+    /// <summary>
+    /// Gets the number of callers waiting for a replica
+    /// </summary>
+    public int Waiting => Volatile.Read(ref _waiting);
+
+    /// <summary>
+    /// Gets all replicas in the pool
+    /// </summary>
+    public IReadOnlyList<TPipeline> Replicas => _replicas;
+
+    /// <summary>
+    /// Rents a replica, waiting until one is idle
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>A lease that returns the replica to the pool when disposed</returns>
+    public async ValueTask<PipelineLease<TPipeline>> RentAsync(CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+
+        if (_idle.Reader.TryRead(out var replica))
+            return new PipelineLease<TPipeline>(this, replica);
+
+        Interlocked.Increment(ref _waiting);
+        try
+        {
+            replica = await _idle.Reader.ReadAsync(cancellationToken).ConfigureAwait(false);
+        }
+        catch (ChannelClosedException)
+        {
+            throw new ObjectDisposedException(nameof(PipelinePool<TPipeline>));
+        }
+        finally
+        {
+            Interlocked.Decrement(ref _waiting);
+        }
+
+        return new PipelineLease<TPipeline>(this, replica);
+    }
+
+    /// <summary>
+    /// Tries to rent an idle replica without waiting
+    /// </summary>
+    /// <param name="lease">The lease if a replica was idle</param>
+    /// <returns>True if a replica was rented</returns>
+    public bool TryRent(out PipelineLease<TPipeline>? lease)
+    {
+        ThrowIfDisposed();
+
+        if (_idle.Reader.TryRead(out var replica))
+        {
+            lease = new PipelineLease<TPipeline>(this, replica);
+            return true;
+        }
+
+        lease = null;
+        return false;
+    }
+
+    /// <summary>
+    /// Raised after a replica is returned, for schedulers that rent with <see cref="TryRent"/>
+    /// </summary>
+    internal event Action? ReplicaReturned;
+
+    internal void Return(TPipeline replica)
+    {
+        if (_idle.Writer.TryWrite(replica))
+        {
+            ReplicaReturned?.Invoke();
+        }
+        else if (_ownsReplicas)
+        {
+            // The pool was disposed while the replica was rented
+            replica.Dispose();
+        }
+    }
+
+    /// <summary>
+    /// Releases the pool and, if owned, all replicas
+    /// </summary>
+    public void Dispose()
+    {
+        if (!_disposed)
+        {
+            _disposed = true;
+            _idle.Writer.TryComplete();
+
+            if (_ownsReplicas)
+            {
+                while (_idle.Reader.TryRead(out var replica))
+                {
+                    replica.Dispose();
+                }
+            }
+        }
+    }
+
+    private static Func<TPipeline> CreatePlacedFactory(Func<ReplicaPlacement, TPipeline> factory, IReadOnlyList<ReplicaPlacement> placements)
+    {
+        if (factory == null)
+            throw new ArgumentNullException(nameof(factory));
+        if (placements == null)
+            throw new ArgumentNullException(nameof(placements));
+
+        // Replicas are created in order, one per placement
+        var next = 0;
+        return () => factory(placements[next++]);
+    }
+
+    private static Channel<TPipeline> CreateIdleChannel(TPipeline[] replicas)
+    {
+        var channel = Channel.CreateUnbounded<TPipeline>();
+        foreach (var replica in replicas)
+        {
+            channel.Writer.TryWrite(replica);
+        }
+        return channel;
+    }
+
+    private void ThrowIfDisposed()
+    {
+        if (_disposed)
+            throw new ObjectDisposedException(nameof(PipelinePool<TPipeline>));
+    }
+}
+
+/// <summary>
+/// A rented pipeline replica; disposing the lease returns the replica to its pool
+/// </summary>
+/// <typeparam name="TPipeline">Pipeline type</typeparam>
+public sealed class PipelineLease<TPipeline> : IDisposable where TPipeline : class, IDisposable
+{
+    private readonly PipelinePool<TPipeline> _pool;
+    private int _returned;
+
+    internal PipelineLease(PipelinePool<TPipeline> pool, TPipeline pipeline)
+    {
+        _pool = pool;
+        Pipeline = pipeline;
+    }
+
+    /// <summary>
+    /// Gets the rented pipeline
+    /// </summary>
+    public TPipeline Pipeline { get; }
+
+    /// <summary>
+    /// Returns the pipeline to the pool
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.Exchange(ref _returned, 1) == 0)
+        {
+            _pool.Return(Pipeline);
+        }
+    }
+}
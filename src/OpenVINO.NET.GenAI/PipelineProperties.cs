@@ -0,0 +1,301 @@
+using System.Collections;
+using System.Globalization;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// OpenVINO device and compile properties passed when a pipeline is created
+/// </summary>
+/// <remarks>
+/// Properties are passed to the native pipeline as variadic key/value arguments,
+/// so at most <see cref="MaxCount"/> properties are supported.
+/// </remarks>
+public sealed class PipelineProperties : IReadOnlyCollection<KeyValuePair<string, string>>
+{
+    /// <summary>
+    /// Maximum number of properties that can be passed to the native pipeline
+    /// </summary>
+    public const int MaxCount = 8;
+
+    private readonly List<KeyValuePair<string, string>> _properties = new();
+
+    /// <summary>
+    /// Gets the number of properties
+    /// </summary>
+    public int Count => _properties.Count;
+
+    /// <summary>
+    /// Gets the value of a property, or null if it is not set
+    /// </summary>
+    /// <param name="key">Property name</param>
+    public string? this[string key]
+    {
+        get
+        {
+            var index = IndexOf(key);
+            return index >= 0 ? _properties[index].Value : null;
+        }
+    }
+
+    /// <summary>
+    /// Sets the directory where compiled models are cached, which avoids recompiling on later loads
+    /// </summary>
+    /// <param name="cacheDir">Cache directory</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithCacheDir(string cacheDir)
+    {
+        if (string.IsNullOrEmpty(cacheDir))
+            throw new ArgumentException("Cache directory cannot be null or empty", nameof(cacheDir));
+
+        return Set("CACHE_DIR", cacheDir);
+    }
+
+    /// <summary>
+    /// Sets the number of threads used for inference
+    /// </summary>
+    /// <param name="numThreads">Number of threads</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithInferenceNumThreads(int numThreads)
+    {
+        if (numThreads <= 0)
+            throw new ArgumentOutOfRangeException(nameof(numThreads), "Number of threads must be positive");
+
+        return Set("INFERENCE_NUM_THREADS", numThreads.ToString(CultureInfo.InvariantCulture));
+    }
+
+    /// <summary>
+    /// Sets the performance hint
+    /// </summary>
+    /// <param name="hint">Performance hint</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithPerformanceHint(PerformanceHint hint)
+    {
+        var value = hint switch
+        {
+            PerformanceHint.Latency => "LATENCY",
+            PerformanceHint.Throughput => "THROUGHPUT",
+            PerformanceHint.CumulativeThroughput => "CUMULATIVE_THROUGHPUT",
+            _ => throw new ArgumentOutOfRangeException(nameof(hint))
+        };
+
+        return Set("PERFORMANCE_HINT", value);
+    }
+
+    /// <summary>
+    /// Sets the number of inference streams
+    /// </summary>
+    /// <param name="numStreams">Number of streams</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithNumStreams(int numStreams)
+    {
+        if (numStreams <= 0)
+            throw new ArgumentOutOfRangeException(nameof(numStreams), "Number of streams must be positive");
+
+        return Set("NUM_STREAMS", numStreams.ToString(CultureInfo.InvariantCulture));
+    }
+
+    /// <summary>
+    /// Sets the precision used for inference
+    /// </summary>
+    /// <param name="precision">Inference precision</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithInferencePrecision(InferencePrecision precision)
+    {
+        var value = precision switch
+        {
+            InferencePrecision.F32 => "f32",
+            InferencePrecision.F16 => "f16",
+            InferencePrecision.BF16 => "bf16",
+            _ => throw new ArgumentOutOfRangeException(nameof(precision))
+        };
+
+        return Set("INFERENCE_PRECISION_HINT", value);
+    }
+
+    /// <summary>
+    /// Sets the precision of the KV cache. Lower precision fits longer contexts and more sessions in memory.
+    /// </summary>
+    /// <param name="precision">KV cache precision</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithKVCachePrecision(KVCachePrecision precision)
+    {
+        var value = precision switch
+        {
+            KVCachePrecision.U8 => "u8",
+            KVCachePrecision.F16 => "f16",
+            KVCachePrecision.BF16 => "bf16",
+            KVCachePrecision.F32 => "f32",
+            _ => throw new ArgumentOutOfRangeException(nameof(precision))
+        };
+
+        return Set("KV_CACHE_PRECISION", value);
+    }
+
+    /// <summary>
+    /// Sets whether model weights are memory-mapped from the model files instead of copied.
+    /// Mapped weights are shared by all pipelines of the process that load the same files.
+    /// </summary>
+    /// <remarks>
+    /// OpenVINO maps weights by default, so this matters mainly to turn mapping off, for
+    /// example to copy weights into NUMA-local memory.
+    /// </remarks>
+    /// <param name="enable">True to memory-map weights</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithMmap(bool enable = true)
+    {
+        return Set("ENABLE_MMAP", enable ? "YES" : "NO");
+    }
+
+    /// <summary>
+    /// Sets whether CPU inference threads are pinned to cores. Pinned threads keep their
+    /// caches and their NUMA-local memory instead of migrating between cores.
+    /// </summary>
+    /// <param name="enable">True to pin threads</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties WithCpuPinning(bool enable = true)
+    {
+        return Set("ENABLE_CPU_PINNING", enable ? "YES" : "NO");
+    }
+
+    /// <summary>
+    /// Sets a property by name, replacing any previous value
+    /// </summary>
+    /// <param name="key">Property name (e.g., "CACHE_DIR")</param>
+    /// <param name="value">Property value</param>
+    /// <returns>This instance for fluent chaining</returns>
+    public PipelineProperties Set(string key, string value)
+    {
+        if (string.IsNullOrEmpty(key))
+            throw new ArgumentException("Property name cannot be null or empty", nameof(key));
+        if (value == null)
+            throw new ArgumentNullException(nameof(value));
+
+        var index = IndexOf(key);
+        if (index >= 0)
+        {
+            _properties[index] = new KeyValuePair<string, string>(key, value);
+            return this;
+        }
+
+        if (_properties.Count == MaxCount)
+            throw new InvalidOperationException($"At most {MaxCount} pipeline properties are supported");
+
+        _properties.Add(new KeyValuePair<string, string>(key, value));
+        return this;
+    }
+
+    /// <summary>
+    /// Creates properties from a dictionary
+    /// </summary>
+    /// <param name="properties">Property names and values</param>
+    /// <returns>The properties</returns>
+    public static PipelineProperties FromDictionary(IEnumerable<KeyValuePair<string, string>> properties)
+    {
+        if (properties == null)
+            throw new ArgumentNullException(nameof(properties));
+
+        var result = new PipelineProperties();
+        foreach (var property in properties)
+        {
+            result.Set(property.Key, property.Value);
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Creates a copy of these properties
+    /// </summary>
+    internal PipelineProperties Clone() => FromDictionary(_properties);
+
+    /// <summary>
+    /// Returns an enumerator that iterates through the properties
+    /// </summary>
+    public IEnumerator<KeyValuePair<string, string>> GetEnumerator() => _properties.GetEnumerator();
+
+    IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+    /// <summary>
+    /// Gets the properties as variadic arguments: key/value pairs padded with nulls to <see cref="MaxCount"/> pairs
+    /// </summary>
+    internal string?[] ToNativeArgs()
+    {
+        var args = new string?[MaxCount * 2];
+        for (int i = 0; i < _properties.Count; i++)
+        {
+            args[2 * i] = _properties[i].Key;
+            args[2 * i + 1] = _properties[i].Value;
+        }
+        return args;
+    }
+
+    private int IndexOf(string key) =>
+        _properties.FindIndex(p => string.Equals(p.Key, key, StringComparison.Ordinal));
+}
+
+/// <summary>
+/// OpenVINO performance hints
+/// </summary>
+public enum PerformanceHint
+{
+    /// <summary>
+    /// Optimize for the latency of a single request
+    /// </summary>
+    Latency,
+
+    /// <summary>
+    /// Optimize for the throughput of many parallel requests
+    /// </summary>
+    Throughput,
+
+    /// <summary>
+    /// Optimize for throughput across all devices of a multi-device configuration
+    /// </summary>
+    CumulativeThroughput
+}
+
+/// <summary>
+/// KV cache precisions
+/// </summary>
+public enum KVCachePrecision
+{
+    /// <summary>
+    /// 8-bit unsigned integer with per-group scales
+    /// </summary>
+    U8,
+
+    /// <summary>
+    /// 16-bit floating point
+    /// </summary>
+    F16,
+
+    /// <summary>
+    /// 16-bit brain floating point
+    /// </summary>
+    BF16,
+
+    /// <summary>
+    /// 32-bit floating point
+    /// </summary>
+    F32
+}
+
+/// <summary>
+/// Inference precision hints
+/// </summary>
+public enum InferencePrecision
+{
+    /// <summary>
+    /// 32-bit floating point
+    /// </summary>
+    F32,
+
+    /// <summary>
+    /// 16-bit floating point
+    /// </summary>
+    F16,
+
+    /// <summary>
+    /// 16-bit brain floating point
+    /// </summary>
+    BF16
+}
@@ -0,0 +1,52 @@
+using System.Diagnostics;
+using System.Globalization;
+using System.Runtime.InteropServices;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Reads the private memory of the current process
+/// </summary>
+internal static class ProcessMemory
+{
+    private const string SmapsRollupPath = "/proc/self/smaps_rollup";
+
+    /// <summary>
+    /// Gets the bytes of memory that belong to this process only. Clean pages of memory-mapped
+    /// files, such as weights read with ENABLE_MMAP, are shared through the page cache and are
+    /// not counted.
+    /// </summary>
+    public static long GetPrivateBytes()
+    {
+        if (RuntimeInformation.IsOSPlatform(OSPlatform.Linux) && File.Exists(SmapsRollupPath))
+        {
+            try
+            {
+                return ReadPrivateDirty(SmapsRollupPath);
+            }
+            catch (IOException)
+            {
+            }
+        }
+
+        // Windows reports committed private bytes, which excludes file mappings
+        using var process = Process.GetCurrentProcess();
+        return process.PrivateMemorySize64;
+    }
+
+    private static long ReadPrivateDirty(string path)
+    {
+        foreach (var line in File.ReadLines(path))
+        {
+            // Format: "Private_Dirty:      1234 kB"
+            if (!line.StartsWith("Private_Dirty:", StringComparison.Ordinal))
+                continue;
+
+            var value = line.Substring("Private_Dirty:".Length).Trim();
+            var end = value.IndexOf(' ');
+            return long.Parse(end > 0 ? value.Substring(0, end) : value, CultureInfo.InvariantCulture) * 1024;
+        }
+
+        throw new IOException($"Private_Dirty not found in {path}");
+    }
+}
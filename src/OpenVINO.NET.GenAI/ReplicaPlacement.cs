@@ -0,0 +1,261 @@
+using System.Globalization;
+using System.Runtime.InteropServices;
+using Fluid.OpenVINO.GenAI.Native;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// A NUMA node of the host and the logical CPUs that belong to it
+/// </summary>
+public sealed class NumaNode
+{
+    private const string NodeDirectory = "/sys/devices/system/node";
+
+    /// <summary>
+    /// Initializes a new instance of the NumaNode class
+    /// </summary>
+    /// <param name="id">Node number</param>
+    /// <param name="cpus">Logical CPU numbers on the node</param>
+    public NumaNode(int id, IEnumerable<int> cpus)
+    {
+        if (cpus == null)
+            throw new ArgumentNullException(nameof(cpus));
+
+        Id = id;
+        Cpus = cpus.Distinct().OrderBy(c => c).ToArray();
+        if (Cpus.Count == 0)
+            throw new ArgumentException("A NUMA node needs at least one CPU", nameof(cpus));
+    }
+
+    /// <summary>
+    /// Gets the node number
+    /// </summary>
+    public int Id { get; }
+
+    /// <summary>
+    /// Gets the logical CPU numbers on the node
+    /// </summary>
+    public IReadOnlyList<int> Cpus { get; }
+
+    /// <summary>
+    /// Gets the NUMA nodes of the host
+    /// </summary>
+    /// <remarks>
+    /// Read from sysfs on Linux. Other platforms, and hosts without NUMA information, are
+    /// reported as a single node holding every processor.
+    /// </remarks>
+    /// <returns>The nodes, ordered by number</returns>
+    public static IReadOnlyList<NumaNode> GetNodes()
+    {
+        var nodes = new List<NumaNode>();
+        if (RuntimeInformation.IsOSPlatform(OSPlatform.Linux) && Directory.Exists(NodeDirectory))
+        {
+            try
+            {
+                foreach (var directory in Directory.EnumerateDirectories(NodeDirectory, "node*"))
+                {
+                    var name = Path.GetFileName(directory);
+                    var cpuListPath = Path.Combine(directory, "cpulist");
+                    if (!int.TryParse(name.Substring(4), NumberStyles.None, CultureInfo.InvariantCulture, out var id) || !File.Exists(cpuListPath))
+                        continue;
+
+                    var cpus = ParseCpuList(File.ReadAllText(cpuListPath));
+
+                    // Memory-only nodes have no CPUs
+                    if (cpus.Count > 0)
+                        nodes.Add(new NumaNode(id, cpus));
+                }
+            }
+            catch (Exception ex) when (ex is IOException or UnauthorizedAccessException or FormatException)
+            {
+                nodes.Clear();
+            }
+        }
+
+        if (nodes.Count == 0)
+            nodes.Add(new NumaNode(0, Enumerable.Range(0, Environment.ProcessorCount)));
+
+        return nodes.OrderBy(n => n.Id).ToArray();
+    }
+
+    /// <summary>
+    /// Parses a Linux CPU list such as "0-15,32-47"
+    /// </summary>
+    internal static List<int> ParseCpuList(string text)
+    {
+        var cpus = new List<int>();
+        foreach (var part in text.Trim().Split(',', StringSplitOptions.RemoveEmptyEntries))
+        {
+            var range = part.Split('-');
+            var first = int.Parse(range[0], NumberStyles.None, CultureInfo.InvariantCulture);
+            var last = range.Length > 1 ? int.Parse(range[1], NumberStyles.None, CultureInfo.InvariantCulture) : first;
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                cpus.Add(cpu);
+            }
+        }
+        return cpus;
+    }
+
+    /// <inheritdoc/>
+    public override string ToString() => $"node{Id} ({Cpus.Count} CPUs)";
+}
+
+/// <summary>
+/// Places a pipeline replica on a NUMA node and a set of cores
+/// </summary>
+/// <remarks>
+/// On CPU the replica is compiled with ENABLE_CPU_PINNING and one inference thread per core,
+/// and with ENABLE_MMAP off unless set explicitly, so weights are copied into memory of the
+/// node rather than shared through the page cache. On Linux the threads that create the
+/// pipeline and call it are bound to the cores while they do, so the runtime's worker threads
+/// are reserved on those cores and pages are first touched, and therefore allocated, on the node.
+/// Decoding is memory-bandwidth bound, which is where cross-socket traffic costs the most.
+/// </remarks>
+public sealed class ReplicaPlacement
+{
+    private const int MaskWords = 16; // 1024 CPUs
+
+    /// <summary>
+    /// Initializes a new instance of the ReplicaPlacement class
+    /// </summary>
+    /// <param name="node">NUMA node</param>
+    /// <param name="cpus">Cores to use, or null for every CPU of the node</param>
+    public ReplicaPlacement(NumaNode node, IEnumerable<int>? cpus = null)
+    {
+        Node = node ?? throw new ArgumentNullException(nameof(node));
+        Cpus = cpus?.Distinct().OrderBy(c => c).ToArray() ?? node.Cpus;
+        if (Cpus.Count == 0)
+            throw new ArgumentException("A placement needs at least one CPU", nameof(cpus));
+        if (Cpus.Any(c => c < 0 || c >= MaskWords * 64))
+            throw new ArgumentOutOfRangeException(nameof(cpus), "CPU number is out of range");
+    }
+
+    /// <summary>
+    /// Gets the NUMA node
+    /// </summary>
+    public NumaNode Node { get; }
+
+    /// <summary>
+    /// Gets the cores the replica runs on
+    /// </summary>
+    public IReadOnlyList<int> Cpus { get; }
+
+    /// <summary>
+    /// Splits the host's NUMA nodes between pool replicas
+    /// </summary>
+    /// <param name="replicas">Number of replicas</param>
+    /// <returns>One placement per replica</returns>
+    public static IReadOnlyList<ReplicaPlacement> Partition(int replicas) => Partition(replicas, NumaNode.GetNodes());
+
+    /// <summary>
+    /// Splits NUMA nodes between pool replicas: replicas are spread round-robin over the nodes,
+    /// and the replicas of one node divide its cores into disjoint sets
+    /// </summary>
+    /// <param name="replicas">Number of replicas</param>
+    /// <param name="nodes">Nodes to use</param>
+    /// <returns>One placement per replica</returns>
+    public static IReadOnlyList<ReplicaPlacement> Partition(int replicas, IReadOnlyList<NumaNode> nodes)
+    {
+        if (replicas <= 0)
+            throw new ArgumentOutOfRangeException(nameof(replicas), "Number of replicas must be positive");
+        if (nodes == null)
+            throw new ArgumentNullException(nameof(nodes));
+        if (nodes.Count == 0)
+            throw new ArgumentException("At least one NUMA node is required", nameof(nodes));
+
+        var placements = new ReplicaPlacement[replicas];
+        for (int n = 0; n < nodes.Count; n++)
+        {
+            var node = nodes[n];
+            var onNode = Enumerable.Range(0, replicas).Where(r => r % nodes.Count == n).ToArray();
+            for (int k = 0; k < onNode.Length; k++)
+            {
+                // More replicas than cores on a node share cores rather than getting none
+                var start = (int)((long)k * node.Cpus.Count / onNode.Length);
+                var end = (int)((long)(k + 1) * node.Cpus.Count / onNode.Length);
+                var cpus = end > start
+                    ? node.Cpus.Skip(start).Take(end - start)
+                    : new[] { node.Cpus[k % node.Cpus.Count] };
+                placements[onNode[k]] = new ReplicaPlacement(node, cpus);
+            }
+        }
+
+        return placements;
+    }
+
+    /// <summary>
+    /// Adds the placement's CPU properties for a device; other devices only get thread binding
+    /// </summary>
+    internal PipelineProperties? ApplyTo(PipelineProperties? properties, string device)
+    {
+        if (!string.Equals(device, "CPU", StringComparison.OrdinalIgnoreCase))
+            return properties;
+
+        var placed = properties?.Clone() ?? new PipelineProperties();
+        placed.WithCpuPinning().WithInferenceNumThreads(Cpus.Count);
+        if (placed["ENABLE_MMAP"] == null)
+            placed.WithMmap(false);
+        return placed;
+    }
+
+    /// <summary>
+    /// Binds the calling thread to the placement's cores until the returned scope is disposed
+    /// </summary>
+    /// <returns>A scope that restores the previous affinity, or null where binding is unsupported</returns>
+    internal IDisposable? Bind()
+    {
+        if (!RuntimeInformation.IsOSPlatform(OSPlatform.Linux))
+            return null;
+
+        var previous = new ulong[MaskWords];
+        if (LinuxNativeMethods.sched_getaffinity(0, (nuint)(MaskWords * sizeof(ulong)), previous) != 0)
+            return null;
+
+        var mask = new ulong[MaskWords];
+        foreach (var cpu in Cpus)
+        {
+            mask[cpu / 64] |= 1UL << (cpu % 64);
+        }
+
+        // Binding is an optimization: a container that forbids these CPUs still runs unbound
+        if (LinuxNativeMethods.sched_setaffinity(0, (nuint)(MaskWords * sizeof(ulong)), mask) != 0)
+            return null;
+
+        return new AffinityScope(previous);
+    }
+
+    /// <inheritdoc/>
+    public override string ToString() => $"node{Node.Id} CPUs {FormatCpus()}";
+
+    private string FormatCpus()
+    {
+        var ranges = new List<string>();
+        for (int i = 0; i < Cpus.Count;)
+        {
+            var j = i;
+            while (j + 1 < Cpus.Count && Cpus[j + 1] == Cpus[j] + 1)
+                j++;
+            ranges.Add(i == j ? Cpus[i].ToString(CultureInfo.InvariantCulture) : $"{Cpus[i]}-{Cpus[j]}");
+            i = j + 1;
+        }
+        return string.Join(",", ranges);
+    }
+
+    private sealed class AffinityScope : IDisposable
+    {
+        private readonly ulong[] _previous;
+        private bool _disposed;
+
+        public AffinityScope(ulong[] previous) => _previous = previous;
+
+        public void Dispose()
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            LinuxNativeMethods.sched_setaffinity(0, (nuint)(_previous.Length * sizeof(ulong)), _previous);
+        }
+    }
+}
@@ -0,0 +1,35 @@
+using System.Runtime.InteropServices;
+
+namespace Fluid.OpenVINO.GenAI.SafeHandles;
+
+/// <summary>
+/// Holds a reference on a safe handle for the duration of a native call, so disposing its
+/// owner on another thread does not free it while in use
+/// </summary>
+internal readonly struct HandleReference : IDisposable
+{
+    private readonly SafeHandle? _handle;
+
+    /// <summary>
+    /// Adds a reference to the handle, if any
+    /// </summary>
+    /// <exception cref="ObjectDisposedException">The handle was already released</exception>
+    public HandleReference(SafeHandle? handle)
+    {
+        _handle = null;
+        if (handle == null)
+            return;
+
+        var added = false;
+        handle.DangerousAddRef(ref added);
+        if (added)
+            _handle = handle;
+    }
+
+    /// <summary>
+    /// Gets the native handle, or zero when there is none; valid until disposed
+    /// </summary>
+    public IntPtr Value => _handle?.DangerousGetHandle() ?? IntPtr.Zero;
+
+    public void Dispose() => _handle?.DangerousRelease();
+}
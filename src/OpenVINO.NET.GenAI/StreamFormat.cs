@@ -0,0 +1,35 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Framing of generated text written to a pipe, stream or buffer
+/// </summary>
+public enum StreamFormat
+{
+    /// <summary>
+    /// The UTF-8 text as generated, without framing
+    /// </summary>
+    Raw,
+
+    /// <summary>
+    /// One server-sent event per token or chunk: "data: " lines followed by a blank line
+    /// </summary>
+    Sse,
+
+    /// <summary>
+    /// One JSON object per line: {"token":"..."} for LLM tokens, {"start":..,"end":..,"text":"..."} for Whisper chunks
+    /// </summary>
+    Ndjson
+}
+
+/// <summary>
+/// Outcome of a generation written to a pipe, stream or buffer
+/// </summary>
+/// <param name="Tokens">Number of streamed tokens</param>
+/// <param name="BytesWritten">Bytes written, including framing</param>
+/// <param name="IsTruncatedByDeadline">Whether decoding was stopped early to meet the request's deadline</param>
+/// <param name="IsStoppedByCondition">Whether decoding was stopped by one of the request's stop conditions</param>
+public sealed record StreamedGenerationResult(
+    int Tokens,
+    long BytesWritten,
+    bool IsTruncatedByDeadline,
+    bool IsStoppedByCondition);
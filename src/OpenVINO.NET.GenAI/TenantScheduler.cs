@@ -0,0 +1,864 @@
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using Fluid.OpenVINO.GenAI.Exceptions;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Schedules requests of several tenants onto a pipeline pool: strict priority classes,
+/// weighted fair queueing between tenants of one class, and token-bucket rate limits on
+/// prompt and generated tokens
+/// </summary>
+/// <remarks>
+/// Fair queueing uses start-time tags: a request's cost is estimated when it is queued
+/// and corrected with the tokens actually reported through its <see cref="TenantLease{TPipeline}"/>,
+/// so a tenant whose generations run long is scheduled correspondingly less often. A tenant
+/// whose bucket is in debt waits until the bucket refills; requests already running are not
+/// interrupted. The scheduler should be the only user of the pool; replicas rented elsewhere
+/// are simply unavailable to it until returned.
+/// </remarks>
+/// <typeparam name="TPipeline">Pipeline type</typeparam>
+public sealed class TenantScheduler<TPipeline> : IDisposable where TPipeline : class, IDisposable
+{
+    private readonly PipelinePool<TPipeline> _pool;
+    private readonly bool _ownsPool;
+    private readonly Dictionary<string, TenantState> _tenants = new(StringComparer.Ordinal);
+    private readonly object _lock = new();
+    private readonly Timer _refillTimer;
+    private double _virtualTime;
+    private bool _disposed;
+
+    /// <summary>
+    /// Initializes a new instance of the TenantScheduler class
+    /// </summary>
+    /// <param name="pool">Pool whose replicas run the requests</param>
+    /// <param name="ownsPool">Whether disposing the scheduler disposes the pool</param>
+    public TenantScheduler(PipelinePool<TPipeline> pool, bool ownsPool = false)
+    {
+        _pool = pool ?? throw new ArgumentNullException(nameof(pool));
+        _ownsPool = ownsPool;
+        _refillTimer = new Timer(_ => Dispatch(), null, Timeout.Infinite, Timeout.Infinite);
+        _pool.ReplicaReturned += Dispatch;
+    }
+
+    /// <summary>
+    /// Gets or sets the limits of tenants that were not configured with <see cref="ConfigureTenant"/>
+    /// </summary>
+    public TenantLimits DefaultLimits { get; set; } = new();
+
+    /// <summary>
+    /// Sets the limits of a tenant; requests already queued keep their place
+    /// </summary>
+    /// <remarks>
+    /// Rate limit debt carries over, capped at the new burst, so reconfiguring a tenant does
+    /// not let it skip the wait it has already earned.
+    /// </remarks>
+    /// <param name="tenantId">Tenant identifier</param>
+    /// <param name="limits">Limits of the tenant</param>
+    public void ConfigureTenant(string tenantId, TenantLimits limits)
+    {
+        if (string.IsNullOrEmpty(tenantId))
+            throw new ArgumentException("Tenant identifier cannot be null or empty", nameof(tenantId));
+        if (limits == null)
+            throw new ArgumentNullException(nameof(limits));
+
+        limits.Validate();
+        lock (_lock)
+        {
+            GetTenant(tenantId).Configure(limits.Clone());
+        }
+
+        Dispatch();
+    }
+
+    /// <summary>
+    /// Waits for the tenant's turn and rents a replica
+    /// </summary>
+    /// <param name="tenantId">Tenant identifier</param>
+    /// <param name="estimatedPromptTokens">Estimated prompt tokens, charged until the actual count is reported</param>
+    /// <param name="estimatedGeneratedTokens">Estimated generated tokens, used to order the request until actual tokens are reported</param>
+    /// <param name="cancellationToken">Cancellation token; cancels waiting, not the work done with the lease</param>
+    /// <returns>A lease that reports token usage and returns the replica when disposed</returns>
+    /// <exception cref="TenantQueueFullException">The tenant already has <see cref="TenantLimits.MaxQueuedRequests"/> requests waiting</exception>
+    public async Task<TenantLease<TPipeline>> AcquireAsync(
+        string tenantId,
+        int estimatedPromptTokens,
+        int estimatedGeneratedTokens,
+        CancellationToken cancellationToken = default)
+    {
+        if (string.IsNullOrEmpty(tenantId))
+            throw new ArgumentException("Tenant identifier cannot be null or empty", nameof(tenantId));
+        if (estimatedPromptTokens < 0)
+            throw new ArgumentOutOfRangeException(nameof(estimatedPromptTokens), "Token estimate cannot be negative");
+        if (estimatedGeneratedTokens < 0)
+            throw new ArgumentOutOfRangeException(nameof(estimatedGeneratedTokens), "Token estimate cannot be negative");
+
+        PendingRequest request;
+        lock (_lock)
+        {
+            ThrowIfDisposed();
+
+            var tenant = GetTenant(tenantId);
+            if (tenant.Queue.Count >= tenant.Limits.MaxQueuedRequests)
+            {
+                tenant.Rejected++;
+                throw new TenantQueueFullException(tenantId);
+            }
+
+            request = new PendingRequest(tenant, estimatedPromptTokens, estimatedGeneratedTokens);
+
+            // Start-time fair queueing: a request starts where the tenant's previous one finishes,
+            // or at the current virtual time if the tenant was idle
+            request.StartTag = Math.Max(_virtualTime, tenant.LastFinish);
+            request.VirtualCost = request.EstimatedCost / tenant.Limits.Weight;
+            tenant.LastFinish = request.StartTag + request.VirtualCost;
+            tenant.Queue.Enqueue(request);
+            tenant.FirstRequest ??= request.EnqueuedAt;
+        }
+
+        using (cancellationToken.Register(() => Cancel(request)))
+        {
+            Dispatch();
+            return await request.Started.Task.ConfigureAwait(false);
+        }
+    }
+
+    /// <summary>
+    /// Runs work for a tenant on a replica when it is the tenant's turn
+    /// </summary>
+    /// <typeparam name="TResult">Result type</typeparam>
+    /// <param name="tenantId">Tenant identifier</param>
+    /// <param name="estimatedPromptTokens">Estimated prompt tokens</param>
+    /// <param name="estimatedGeneratedTokens">Estimated generated tokens</param>
+    /// <param name="work">Work to run; reports actual token usage through the lease</param>
+    /// <param name="cancellationToken">Cancellation token passed to the work</param>
+    /// <returns>The result of the work</returns>
+    public async Task<TResult> RunAsync<TResult>(
+        string tenantId,
+        int estimatedPromptTokens,
+        int estimatedGeneratedTokens,
+        Func<TenantLease<TPipeline>, CancellationToken, Task<TResult>> work,
+        CancellationToken cancellationToken = default)
+    {
+        if (work == null)
+            throw new ArgumentNullException(nameof(work));
+
+        using var lease = await AcquireAsync(tenantId, estimatedPromptTokens, estimatedGeneratedTokens, cancellationToken).ConfigureAwait(false);
+        return await work(lease, cancellationToken).ConfigureAwait(false);
+    }
+
+    /// <summary>
+    /// Gets the statistics of a tenant
+    /// </summary>
+    /// <param name="tenantId">Tenant identifier</param>
+    /// <returns>The statistics, or null if the tenant has not been seen</returns>
+    public TenantStatistics? GetStatistics(string tenantId)
+    {
+        lock (_lock)
+        {
+            return _tenants.TryGetValue(tenantId, out var tenant) ? tenant.GetStatistics() : null;
+        }
+    }
+
+    /// <summary>
+    /// Gets the statistics of all tenants
+    /// </summary>
+    /// <returns>The statistics, by tenant</returns>
+    public IReadOnlyList<TenantStatistics> GetStatistics()
+    {
+        lock (_lock)
+        {
+            return _tenants.Values.Select(t => t.GetStatistics()).ToArray();
+        }
+    }
+
+    /// <summary>
+    /// Releases the scheduler; waiting requests fail with <see cref="ObjectDisposedException"/>
+    /// </summary>
+    public void Dispose()
+    {
+        List<PendingRequest> waiting;
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            _disposed = true;
+            waiting = _tenants.Values.SelectMany(t => t.Queue).ToList();
+            foreach (var tenant in _tenants.Values)
+            {
+                tenant.Queue.Clear();
+            }
+        }
+
+        _pool.ReplicaReturned -= Dispatch;
+        _refillTimer.Dispose();
+        foreach (var request in waiting)
+        {
+            request.Started.TrySetException(new ObjectDisposedException(nameof(TenantScheduler<TPipeline>)));
+        }
+
+        if (_ownsPool)
+        {
+            _pool.Dispose();
+        }
+    }
+
+    internal void ReportPromptTokens(PendingRequest request, int tokens)
+    {
+        lock (_lock)
+        {
+            var now = Stopwatch.GetTimestamp();
+            var tenant = request.Tenant;
+
+            // The estimate was charged at dispatch; charge only the difference
+            var delta = tokens - request.PromptTokens;
+            request.PromptTokens = tokens;
+            tenant.PromptTokens += delta;
+            tenant.PromptBucket?.Take(delta, now);
+        }
+    }
+
+    internal void ReportGeneratedTokens(PendingRequest request, int tokens)
+    {
+        lock (_lock)
+        {
+            var now = Stopwatch.GetTimestamp();
+            var tenant = request.Tenant;
+            request.GeneratedTokens += tokens;
+            tenant.GeneratedTokens += tokens;
+            tenant.GeneratedBucket?.Take(tokens, now);
+        }
+    }
+
+    internal void Complete(PendingRequest request, PipelineLease<TPipeline> lease)
+    {
+        lock (_lock)
+        {
+            var tenant = request.Tenant;
+            tenant.Running--;
+            tenant.Completed++;
+            tenant.LastCompletion = Stopwatch.GetTimestamp();
+
+            // Replace the estimated cost with the actual one so long generations count in full
+            var actualCost = request.PromptTokens + request.GeneratedTokens;
+            tenant.LastFinish += (actualCost - request.EstimatedCost) / tenant.Limits.Weight;
+        }
+
+        // Returning the replica dispatches the next request
+        lease.Dispose();
+    }
+
+    private TenantState GetTenant(string tenantId)
+    {
+        if (!_tenants.TryGetValue(tenantId, out var tenant))
+        {
+            tenant = new TenantState(tenantId, DefaultLimits.Clone());
+            _tenants.Add(tenantId, tenant);
+        }
+        return tenant;
+    }
+
+    private void Cancel(PendingRequest request)
+    {
+        lock (_lock)
+        {
+            if (request.Dispatched || request.Started.Task.IsCompleted)
+                return;
+
+            // Give back the request's share of virtual time, so the tenant's later requests
+            // and its next one are not pushed back by work that never ran
+            var tenant = request.Tenant;
+            var queue = tenant.Queue;
+            var remaining = queue.Where(r => !ReferenceEquals(r, request)).ToArray();
+            queue.Clear();
+            foreach (var r in remaining)
+            {
+                if (r.StartTag > request.StartTag)
+                    r.StartTag -= request.VirtualCost;
+                queue.Enqueue(r);
+            }
+            tenant.LastFinish -= request.VirtualCost;
+
+            request.Started.TrySetCanceled();
+        }
+
+        // The cancelled request may have been blocking its tenant's queue
+        Dispatch();
+    }
+
+    private void Dispatch()
+    {
+        var started = new List<(PendingRequest Request, TenantLease<TPipeline> Lease)>();
+        var failed = new List<PendingRequest>();
+        lock (_lock)
+        {
+            if (_disposed)
+                return;
+
+            var now = Stopwatch.GetTimestamp();
+            PipelineLease<TPipeline>? replica = null;
+            TimeSpan? nextRefill = null;
+            while (true)
+            {
+                var next = SelectNext(now, ref nextRefill);
+                if (next == null)
+                    break;
+
+                try
+                {
+                    if (!_pool.TryRent(out replica))
+                        break;
+                }
+                catch (ObjectDisposedException)
+                {
+                    // Nothing queued can run any more
+                    foreach (var waiting in _tenants.Values)
+                    {
+                        failed.AddRange(waiting.Queue);
+                        waiting.Queue.Clear();
+                    }
+                    break;
+                }
+
+                var tenant = next.Tenant;
+                tenant.Queue.Dequeue();
+                next.Dispatched = true;
+                tenant.Running++;
+
+                _virtualTime = Math.Max(_virtualTime, next.StartTag);
+
+                tenant.PromptTokens += next.PromptTokens;
+                tenant.PromptBucket?.Take(next.PromptTokens, now);
+
+                var queueTime = GetElapsedTime(next.EnqueuedAt, now);
+                tenant.TotalQueueTime += queueTime;
+                if (queueTime > tenant.MaxQueueTime)
+                    tenant.MaxQueueTime = queueTime;
+
+                started.Add((next, new TenantLease<TPipeline>(this, next, replica!, queueTime)));
+            }
+
+            if (nextRefill.HasValue)
+                _refillTimer.Change(nextRefill.Value + TimeSpan.FromMilliseconds(1), Timeout.InfiniteTimeSpan);
+        }
+
+        // Continuations run outside the lock
+        foreach (var (request, lease) in started)
+        {
+            if (!request.Started.TrySetResult(lease))
+                lease.Dispose();
+        }
+
+        foreach (var request in failed)
+        {
+            request.Started.TrySetException(new ObjectDisposedException(nameof(PipelinePool<TPipeline>)));
+        }
+    }
+
+    private static TimeSpan GetElapsedTime(long start, long end)
+        => TimeSpan.FromSeconds((double)(end - start) / Stopwatch.Frequency);
+
+    /// <summary>
+    /// Picks the head request with the earliest start tag among tenants of the highest priority
+    /// class that are within their rate limits
+    /// </summary>
+    private PendingRequest? SelectNext(long now, ref TimeSpan? nextRefill)
+    {
+        PendingRequest? best = null;
+        foreach (var tenant in _tenants.Values)
+        {
+            if (tenant.Queue.Count == 0)
+                continue;
+
+            var wait = tenant.TimeUntilAllowed(now);
+            if (wait > TimeSpan.Zero)
+            {
+                if (!nextRefill.HasValue || wait < nextRefill.Value)
+                    nextRefill = wait;
+                continue;
+            }
+
+            var head = tenant.Queue.Peek();
+            if (best == null
+                || tenant.Limits.Priority < best.Tenant.Limits.Priority
+                || (tenant.Limits.Priority == best.Tenant.Limits.Priority && head.StartTag < best.StartTag))
+            {
+                best = head;
+            }
+        }
+
+        return best;
+    }
+
+    private void ThrowIfDisposed()
+    {
+        if (_disposed)
+            throw new ObjectDisposedException(nameof(TenantScheduler<TPipeline>));
+    }
+
+    internal sealed class PendingRequest
+    {
+        public PendingRequest(TenantState tenant, int promptTokens, int generatedTokens)
+        {
+            Tenant = tenant;
+            PromptTokens = promptTokens;
+            EstimatedCost = promptTokens + generatedTokens;
+            EnqueuedAt = Stopwatch.GetTimestamp();
+        }
+
+        public TenantState Tenant { get; }
+
+        public TaskCompletionSource<TenantLease<TPipeline>> Started { get; } = new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+        public long EnqueuedAt { get; }
+
+        public double EstimatedCost { get; }
+
+        /// <summary>
+        /// Estimated cost divided by the tenant's weight when the request was queued
+        /// </summary>
+        public double VirtualCost { get; set; }
+
+        public double StartTag { get; set; }
+
+        public bool Dispatched { get; set; }
+
+        public int PromptTokens { get; set; }
+
+        public int GeneratedTokens { get; set; }
+    }
+
+    internal sealed class TenantState
+    {
+        public TenantState(string id, TenantLimits limits)
+        {
+            Id = id;
+            Limits = limits;
+            Configure(limits);
+        }
+
+        public string Id { get; }
+
+        public TenantLimits Limits { get; private set; }
+
+        public TokenBucket? PromptBucket { get; private set; }
+
+        public TokenBucket? GeneratedBucket { get; private set; }
+
+        public Queue<PendingRequest> Queue { get; } = new();
+
+        public double LastFinish { get; set; }
+
+        public int Running { get; set; }
+
+        public long Completed { get; set; }
+
+        public long Rejected { get; set; }
+
+        public long PromptTokens { get; set; }
+
+        public long GeneratedTokens { get; set; }
+
+        public TimeSpan TotalQueueTime { get; set; }
+
+        public TimeSpan MaxQueueTime { get; set; }
+
+        public long? FirstRequest { get; set; }
+
+        public long? LastCompletion { get; set; }
+
+        public void Configure(TenantLimits limits)
+        {
+            Limits = limits;
+            PromptBucket = CreateBucket(PromptBucket, limits.PromptTokensPerSecond, limits.PromptTokenBurst);
+            GeneratedBucket = CreateBucket(GeneratedBucket, limits.GeneratedTokensPerSecond, limits.GeneratedTokenBurst);
+        }
+
+        private static TokenBucket? CreateBucket(TokenBucket? current, double? rate, double? burst)
+        {
+            if (!rate.HasValue)
+                return null;
+
+            var bucket = new TokenBucket(rate.Value, burst ?? rate.Value);
+            current?.CopyLevelTo(bucket, Stopwatch.GetTimestamp());
+            return bucket;
+        }
+
+        public TimeSpan TimeUntilAllowed(long now)
+        {
+            var prompt = PromptBucket?.TimeUntilAvailable(now) ?? TimeSpan.Zero;
+            var generated = GeneratedBucket?.TimeUntilAvailable(now) ?? TimeSpan.Zero;
+            return prompt > generated ? prompt : generated;
+        }
+
+        public TenantStatistics GetStatistics()
+        {
+            var started = Completed + Running;
+            var elapsed = FirstRequest.HasValue
+                ? GetElapsedTime(FirstRequest.Value, LastCompletion ?? Stopwatch.GetTimestamp())
+                : TimeSpan.Zero;
+
+            return new TenantStatistics(
+                Id,
+                Queue.Count,
+                Running,
+                Completed,
+                Rejected,
+                PromptTokens,
+                GeneratedTokens,
+                started > 0 ? TimeSpan.FromTicks(TotalQueueTime.Ticks / started) : TimeSpan.Zero,
+                MaxQueueTime,
+                elapsed > TimeSpan.Zero ? GeneratedTokens / elapsed.TotalSeconds : 0);
+        }
+    }
+}
+
+/// <summary>
+/// A replica rented through a <see cref="TenantScheduler{TPipeline}"/>; disposing it records the
+/// request's token usage and returns the replica
+/// </summary>
+/// <typeparam name="TPipeline">Pipeline type</typeparam>
+public sealed class TenantLease<TPipeline> : IDisposable where TPipeline : class, IDisposable
+{
+    private readonly TenantScheduler<TPipeline> _scheduler;
+    private readonly TenantScheduler<TPipeline>.PendingRequest _request;
+    private readonly PipelineLease<TPipeline> _lease;
+    private int _completed;
+
+    internal TenantLease(
+        TenantScheduler<TPipeline> scheduler,
+        TenantScheduler<TPipeline>.PendingRequest request,
+        PipelineLease<TPipeline> lease,
+        TimeSpan queueTime)
+    {
+        _scheduler = scheduler;
+        _request = request;
+        _lease = lease;
+        QueueTime = queueTime;
+    }
+
+    /// <summary>
+    /// Gets the rented pipeline
+    /// </summary>
+    public TPipeline Pipeline => _lease.Pipeline;
+
+    /// <summary>
+    /// Gets the tenant the request belongs to
+    /// </summary>
+    public string TenantId => _request.Tenant.Id;
+
+    /// <summary>
+    /// Gets how long the request waited for its turn
+    /// </summary>
+    public TimeSpan QueueTime { get; }
+
+    /// <summary>
+    /// Replaces the estimated prompt tokens with the actual count
+    /// </summary>
+    /// <param name="tokens">Prompt tokens</param>
+    public void ReportPromptTokens(int tokens)
+    {
+        if (tokens < 0)
+            throw new ArgumentOutOfRangeException(nameof(tokens), "Token count cannot be negative");
+
+        _scheduler.ReportPromptTokens(_request, tokens);
+    }
+
+    /// <summary>
+    /// Charges generated tokens to the tenant; can be called per streamed token
+    /// </summary>
+    /// <param name="tokens">Generated tokens</param>
+    public void ReportGeneratedTokens(int tokens)
+    {
+        if (tokens < 0)
+            throw new ArgumentOutOfRangeException(nameof(tokens), "Token count cannot be negative");
+
+        _scheduler.ReportGeneratedTokens(_request, tokens);
+    }
+
+    /// <summary>
+    /// Completes the request and returns the replica
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.Exchange(ref _completed, 1) == 0)
+        {
+            _scheduler.Complete(_request, _lease);
+        }
+    }
+}
+
+/// <summary>
+/// Limits and scheduling weight of a tenant
+/// </summary>
+public sealed class TenantLimits
+{
+    /// <summary>
+    /// Gets or sets the share of the pool relative to other tenants of the same priority
+    /// </summary>
+    public double Weight { get; set; } = 1;
+
+    /// <summary>
+    /// Gets or sets the priority class; higher classes are always served first
+    /// </summary>
+    public RequestPriority Priority { get; set; } = RequestPriority.Normal;
+
+    /// <summary>
+    /// Gets or sets the sustained prompt token rate, or null for no limit
+    /// </summary>
+    public double? PromptTokensPerSecond { get; set; }
+
+    /// <summary>
+    /// Gets or sets the prompt tokens that can be used at once, or null for one second's worth
+    /// </summary>
+    public double? PromptTokenBurst { get; set; }
+
+    /// <summary>
+    /// Gets or sets the sustained generated token rate, or null for no limit
+    /// </summary>
+    public double? GeneratedTokensPerSecond { get; set; }
+
+    /// <summary>
+    /// Gets or sets the generated tokens that can be used at once, or null for one second's worth
+    /// </summary>
+    public double? GeneratedTokenBurst { get; set; }
+
+    /// <summary>
+    /// Gets or sets the maximum number of waiting requests; further requests are rejected
+    /// </summary>
+    public int MaxQueuedRequests { get; set; } = 64;
+
+    internal TenantLimits Clone() => (TenantLimits)MemberwiseClone();
+
+    internal void Validate()
+    {
+        if (!(Weight > 0) || double.IsInfinity(Weight))
+            throw new ArgumentOutOfRangeException(nameof(Weight), "Weight must be positive");
+        if (PromptTokensPerSecond <= 0 || GeneratedTokensPerSecond <= 0)
+            throw new ArgumentOutOfRangeException(nameof(PromptTokensPerSecond), "Token rates must be positive");
+        if (PromptTokenBurst <= 0 || GeneratedTokenBurst <= 0)
+            throw new ArgumentOutOfRangeException(nameof(PromptTokenBurst), "Token bursts must be positive");
+        if (MaxQueuedRequests <= 0)
+            throw new ArgumentOutOfRangeException(nameof(MaxQueuedRequests), "Queue length must be positive");
+    }
+}
+
+/// <summary>
+/// Priority classes of tenants
+/// </summary>
+public enum RequestPriority
+{
+    /// <summary>
+    /// Served before all other classes
+    /// </summary>
+    High,
+
+    /// <summary>
+    /// Served when no high priority request is waiting
+    /// </summary>
+    Normal,
+
+    /// <summary>
+    /// Served only when no other request is waiting
+    /// </summary>
+    Low
+}
+
+/// <summary>
+/// Queueing and throughput statistics of a tenant
+/// </summary>
+/// <param name="TenantId">Tenant identifier</param>
+/// <param name="QueuedRequests">Requests waiting for their turn</param>
+/// <param name="RunningRequests">Requests holding a replica</param>
+/// <param name="CompletedRequests">Requests completed</param>
+/// <param name="RejectedRequests">Requests rejected because the tenant's queue was full</param>
+/// <param name="PromptTokens">Prompt tokens charged</param>
+/// <param name="GeneratedTokens">Generated tokens charged</param>
+/// <param name="AverageQueueTime">Mean time started requests waited</param>
+/// <param name="MaxQueueTime">Longest time a started request waited</param>
+/// <param name="GeneratedTokensPerSecond">Generated tokens per second since the tenant's first request</param>
+public sealed record TenantStatistics(
+    string TenantId,
+    int QueuedRequests,
+    int RunningRequests,
+    long CompletedRequests,
+    long RejectedRequests,
+    long PromptTokens,
+    long GeneratedTokens,
+    TimeSpan AverageQueueTime,
+    TimeSpan MaxQueueTime,
+    double GeneratedTokensPerSecond);
+
+/// <summary>
+/// A token bucket that may go into debt: usage is charged when it is known, and the owner waits until the level recovers
+/// </summary>
+internal sealed class TokenBucket
+{
+    private readonly double _rate;
+    private readonly double _capacity;
+    private double _level;
+    private long _updated;
+
+    public TokenBucket(double rate, double capacity)
+    {
+        _rate = rate;
+        _capacity = capacity;
+        _level = capacity;
+        _updated = Stopwatch.GetTimestamp();
+    }
+
+    public void Take(double tokens, long now)
+    {
+        Refill(now);
+        _level -= tokens;
+    }
+
+    /// <summary>
+    /// Carries this bucket's level, including any debt, over to a replacement with new limits
+    /// </summary>
+    public void CopyLevelTo(TokenBucket bucket, long now)
+    {
+        Refill(now);
+        bucket._level = Math.Min(bucket._capacity, _level);
+        bucket._updated = now;
+    }
+
+    public TimeSpan TimeUntilAvailable(long now)
+    {
+        Refill(now);
+        return _level >= 0 ? TimeSpan.Zero : TimeSpan.FromSeconds(-_level / _rate);
+    }
+
+    private void Refill(long now)
+    {
+        if (now <= _updated)
+            return;
+
+        _level = Math.Min(_capacity, _level + (now - _updated) * _rate / Stopwatch.Frequency);
+        _updated = now;
+    }
+}
+
+/// <summary>
+/// LLM generation through a <see cref="TenantScheduler{TPipeline}"/>, charging the tokens actually processed
+/// </summary>
+public static class TenantSchedulerExtensions
+{
+    // Used when the configuration sets no limit; the native default is unlimited, but most requests stop earlier
+    internal const int DefaultEstimatedTokens = 256;
+
+    // A larger limit is rarely reached, and would hold the tenant back far longer than the request runs
+    internal const int MaxEstimatedTokens = 8192;
+
+    /// <summary>
+    /// Generates text for a tenant when it is the tenant's turn
+    /// </summary>
+    /// <param name="scheduler">Scheduler</param>
+    /// <param name="tenantId">Tenant identifier</param>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>The generation result</returns>
+    public static Task<GenerationResult> GenerateAsync(
+        this TenantScheduler<LLMPipeline> scheduler,
+        string tenantId,
+        string prompt,
+        GenerationConfig? config = null,
+        CancellationToken cancellationToken = default)
+    {
+        if (scheduler == null)
+            throw new ArgumentNullException(nameof(scheduler));
+        if (string.IsNullOrEmpty(prompt))
+            throw new ArgumentException("Prompt cannot be null or empty", nameof(prompt));
+
+        return scheduler.RunAsync(
+            tenantId,
+            EstimatePromptTokens(prompt),
+            EstimateGeneratedTokens(config),
+            async (lease, token) =>
+            {
+                var result = await lease.Pipeline.GenerateAsync(prompt, config, token).ConfigureAwait(false);
+                var metrics = result.PerformanceMetrics;
+                lease.ReportPromptTokens(metrics.NumInputTokens);
+                lease.ReportGeneratedTokens(metrics.NumGenerationTokens);
+                return result;
+            },
+            cancellationToken);
+    }
+
+    /// <summary>
+    /// Streams generated text for a tenant when it is the tenant's turn, charging the tokens
+    /// processed once the stream ends
+    /// </summary>
+    /// <remarks>
+    /// Prompt and generated tokens are charged from the generation's performance metrics. A
+    /// stream abandoned before it completes has no metrics; it is charged one generated token
+    /// per chunk received, a lower bound.
+    /// </remarks>
+    /// <param name="scheduler">Scheduler</param>
+    /// <param name="tenantId">Tenant identifier</param>
+    /// <param name="prompt">The input prompt</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>An async enumerable of generated tokens</returns>
+    public static async IAsyncEnumerable<string> GenerateStreamAsync(
+        this TenantScheduler<LLMPipeline> scheduler,
+        string tenantId,
+        string prompt,
+        GenerationConfig? config = null,
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        if (scheduler == null)
+            throw new ArgumentNullException(nameof(scheduler));
+        if (string.IsNullOrEmpty(prompt))
+            throw new ArgumentException("Prompt cannot be null or empty", nameof(prompt));
+
+        using var lease = await scheduler.AcquireAsync(
+            tenantId,
+            EstimatePromptTokens(prompt),
+            EstimateGeneratedTokens(config),
+            cancellationToken).ConfigureAwait(false);
+
+        var stream = lease.Pipeline.GenerateStreamAsync(prompt, config, new GenerationOptions(), cancellationToken);
+        var chunks = 0;
+        var completed = false;
+        try
+        {
+            await foreach (var token in stream.ConfigureAwait(false))
+            {
+                chunks++;
+                yield return token;
+            }
+            completed = true;
+        }
+        finally
+        {
+            if (completed)
+            {
+                lease.ReportPromptTokens(stream.InputTokens);
+                lease.ReportGeneratedTokens(stream.GeneratedTokens);
+            }
+            else
+            {
+                lease.ReportGeneratedTokens(chunks);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Estimates prompt tokens at about four characters per token, until the actual count is known
+    /// </summary>
+    private static int EstimatePromptTokens(string prompt) => Math.Max(1, prompt.Length / 4);
+
+    /// <summary>
+    /// Estimates generated tokens from the configuration's limit, capped at <see cref="MaxEstimatedTokens"/>
+    /// </summary>
+    internal static int EstimateGeneratedTokens(GenerationConfig? config)
+    {
+        var maxNewTokens = config?.GetMaxNewTokens() ?? 0;
+        if (maxNewTokens <= 0 || maxNewTokens == int.MaxValue)
+            return DefaultEstimatedTokens;
+        return Math.Min(maxNewTokens, MaxEstimatedTokens);
+    }
+}
@@ -0,0 +1,318 @@
+using System.IO.Hashing;
+using System.Runtime.InteropServices;
+using System.Text;
+using Fluid.OpenVINO.GenAI.Logging;
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Content-addressed cache of Whisper transcriptions
+/// </summary>
+/// <remarks>
+/// Entries are keyed by an XxHash128 of the PCM samples, the generation settings and
+/// the model identity, so a hit returns the stored text and chunks without running
+/// feature extraction, the encoder or the decoder. Recent entries are kept in memory
+/// in LRU order; when a directory is given, entries are also written to disk in a
+/// compact binary form and survive restarts. A cache can be shared by several pipelines.
+/// </remarks>
+public sealed class TranscriptionCache
+{
+    private const int FormatVersion = 1;
+    private static readonly byte[] FileMagic = Encoding.ASCII.GetBytes("OVWC");
+
+    private readonly int _memoryCapacity;
+    private readonly string? _directory;
+    private readonly Dictionary<string, LinkedListNode<(string Key, CachedTranscription Value)>> _entries = new(StringComparer.Ordinal);
+    private readonly LinkedList<(string Key, CachedTranscription Value)> _lru = new();
+    private readonly object _lock = new();
+    private readonly ILogger _logger;
+    private long _hits;
+    private long _misses;
+
+    /// <summary>
+    /// Initializes a new instance of the TranscriptionCache class
+    /// </summary>
+    /// <param name="memoryCapacity">Maximum number of entries kept in memory</param>
+    /// <param name="directory">Directory for the on-disk tier, or null to cache in memory only</param>
+    public TranscriptionCache(int memoryCapacity = 256, string? directory = null)
+    {
+        if (memoryCapacity <= 0)
+            throw new ArgumentOutOfRangeException(nameof(memoryCapacity), "Memory capacity must be positive");
+
+        _memoryCapacity = memoryCapacity;
+        _directory = directory;
+        if (_directory != null)
+        {
+            Directory.CreateDirectory(_directory);
+        }
+
+        _logger = GenAILogging.CreateLogger<TranscriptionCache>();
+    }
+
+    /// <summary>
+    /// Gets the number of entries held in memory
+    /// </summary>
+    public int Count
+    {
+        get
+        {
+            lock (_lock)
+            {
+                return _entries.Count;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Gets the number of lookups served from the cache
+    /// </summary>
+    public long Hits => Interlocked.Read(ref _hits);
+
+    /// <summary>
+    /// Gets the number of lookups that required a transcription
+    /// </summary>
+    public long Misses => Interlocked.Read(ref _misses);
+
+    /// <summary>
+    /// Removes all entries from memory and, if present, from disk
+    /// </summary>
+    public void Clear()
+    {
+        lock (_lock)
+        {
+            _entries.Clear();
+            _lru.Clear();
+        }
+
+        if (_directory != null && Directory.Exists(_directory))
+        {
+            foreach (var file in Directory.EnumerateFiles(_directory, "*.bin", SearchOption.AllDirectories))
+            {
+                File.Delete(file);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Computes the cache key of an audio buffer transcribed with the given settings
+    /// </summary>
+    internal static string ComputeKey(ReadOnlySpan<float> audio, string configFingerprint, string modelIdentity)
+    {
+        var hash = new XxHash128();
+        hash.Append(MemoryMarshal.AsBytes(audio));
+        hash.Append(Encoding.UTF8.GetBytes(configFingerprint));
+        hash.Append(Encoding.UTF8.GetBytes(modelIdentity));
+
+        Span<byte> digest = stackalloc byte[16];
+        hash.GetHashAndReset(digest);
+        return Convert.ToHexString(digest);
+    }
+
+    internal bool TryGet(string key, out CachedTranscription entry)
+    {
+        lock (_lock)
+        {
+            if (_entries.TryGetValue(key, out var node))
+            {
+                _lru.Remove(node);
+                _lru.AddFirst(node);
+                entry = node.Value.Value;
+                Interlocked.Increment(ref _hits);
+                return true;
+            }
+        }
+
+        if (TryReadFromDisk(key, out entry))
+        {
+            AddToMemory(key, entry);
+            Interlocked.Increment(ref _hits);
+            return true;
+        }
+
+        Interlocked.Increment(ref _misses);
+        return false;
+    }
+
+    internal void Set(string key, CachedTranscription entry)
+    {
+        AddToMemory(key, entry);
+        WriteToDisk(key, entry);
+    }
+
+    private void AddToMemory(string key, CachedTranscription entry)
+    {
+        lock (_lock)
+        {
+            if (_entries.TryGetValue(key, out var existing))
+            {
+                _lru.Remove(existing);
+            }
+
+            _entries[key] = _lru.AddFirst((key, entry));
+
+            while (_entries.Count > _memoryCapacity)
+            {
+                var last = _lru.Last!;
+                _lru.RemoveLast();
+                _entries.Remove(last.Value.Key);
+            }
+        }
+    }
+
+    private string GetPath(string key) => Path.Combine(_directory!, key.Substring(0, 2), key + ".bin");
+
+    private bool TryReadFromDisk(string key, out CachedTranscription entry)
+    {
+        entry = null!;
+        if (_directory == null)
+            return false;
+
+        var path = GetPath(key);
+        if (!File.Exists(path))
+            return false;
+
+        try
+        {
+            using var reader = new BinaryReader(File.OpenRead(path), Encoding.UTF8);
+            if (!reader.ReadBytes(FileMagic.Length).AsSpan().SequenceEqual(FileMagic) || reader.ReadInt32() != FormatVersion)
+                throw new InvalidDataException("Unrecognized cache file format");
+
+            entry = CachedTranscription.ReadFrom(reader);
+            return true;
+        }
+        catch (Exception ex)
+        {
+            // A damaged or foreign file is a miss, whatever it makes the reader throw
+            Log.CacheReadFailed(_logger, path, ex);
+            return false;
+        }
+    }
+
+    private void WriteToDisk(string key, CachedTranscription entry)
+    {
+        if (_directory == null)
+            return;
+
+        var path = GetPath(key);
+        var tempPath = path + "." + Guid.NewGuid().ToString("N") + ".tmp";
+        try
+        {
+            Directory.CreateDirectory(Path.GetDirectoryName(path)!);
+            using (var writer = new BinaryWriter(File.Create(tempPath), Encoding.UTF8))
+            {
+                writer.Write(FileMagic);
+                writer.Write(FormatVersion);
+                entry.WriteTo(writer);
+            }
+
+            // Readers never observe a partially written entry
+            File.Move(tempPath, path, overwrite: true);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            Log.CacheWriteFailed(_logger, path, ex);
+            try
+            {
+                File.Delete(tempPath);
+            }
+            catch (IOException)
+            {
+            }
+        }
+    }
+}
+
+/// <summary>
+/// A stored transcription: result texts and scores plus compact chunk data
+/// </summary>
+internal sealed class CachedTranscription
+{
+    public CachedTranscription(string[] texts, float[] scores, WhisperChunkBuffer? chunks)
+    {
+        Texts = texts;
+        Scores = scores;
+        Chunks = chunks;
+    }
+
+    public string[] Texts { get; }
+
+    public float[] Scores { get; }
+
+    public WhisperChunkBuffer? Chunks { get; }
+
+    /// <summary>
+    /// Captures the results of one generation
+    /// </summary>
+    public static CachedTranscription FromResults(IReadOnlyList<WhisperDecodedResult> results)
+    {
+        var texts = new string[results.Count];
+        var scores = new float[results.Count];
+        for (int i = 0; i < results.Count; i++)
+        {
+            texts[i] = results[i].Text;
+            scores[i] = results[i].Score;
+        }
+
+        // All results of one generation share the same chunk buffer
+        return new CachedTranscription(texts, scores, results.Count > 0 ? results[0].ChunkBuffer : null);
+    }
+
+    /// <summary>
+    /// Recreates decoded results; no performance metrics are attached since nothing was generated
+    /// </summary>
+    public IReadOnlyList<WhisperDecodedResult> ToResults(bool estimateWords)
+    {
+        var results = new WhisperDecodedResult[Texts.Length];
+        for (int i = 0; i < results.Length; i++)
+        {
+            results[i] = new WhisperDecodedResult(Texts[i], Scores[i], Chunks, null, estimateWords);
+        }
+        return results;
+    }
+
+    public void WriteTo(BinaryWriter writer)
+    {
+        writer.Write(Texts.Length);
+        for (int i = 0; i < Texts.Length; i++)
+        {
+            writer.Write(Texts[i]);
+            writer.Write(Scores[i]);
+        }
+
+        writer.Write(Chunks != null);
+        Chunks?.WriteTo(writer);
+    }
+
+    public static CachedTranscription ReadFrom(BinaryReader reader)
+    {
+        // Each result is at least a string length prefix and a score
+        var count = ReadCount(reader, 1 + sizeof(float));
+
+        var texts = new string[count];
+        var scores = new float[count];
+        for (int i = 0; i < count; i++)
+        {
+            texts[i] = reader.ReadString();
+            scores[i] = reader.ReadSingle();
+        }
+
+        var chunks = reader.ReadBoolean() ? WhisperChunkBuffer.ReadFrom(reader) : null;
+        return new CachedTranscription(texts, scores, chunks);
+    }
+
+    /// <summary>
+    /// Reads an item count and checks that the rest of the stream can hold that many items,
+    /// so a corrupt count can't make the reader allocate arbitrarily large arrays
+    /// </summary>
+    /// <param name="reader">Reader positioned at the count</param>
+    /// <param name="minItemSize">Smallest serialized size of one item in bytes</param>
+    internal static int ReadCount(BinaryReader reader, int minItemSize)
+    {
+        var count = reader.ReadInt32();
+        var stream = reader.BaseStream;
+        if (count < 0 || (long)count * minItemSize > stream.Length - stream.Position)
+            throw new InvalidDataException("Item count exceeds the remaining data");
+        return count;
+    }
+}
@@ -0,0 +1,201 @@
+using System.Globalization;
+using System.IO.Hashing;
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using Fluid.OpenVINO.GenAI.Logging;
+using Microsoft.Extensions.Logging;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// A JSON file of measured settings, keyed by <see cref="TuningKey"/>
+/// </summary>
+/// <typeparam name="TEntry">Stored entry type</typeparam>
+internal sealed class TuningStore<TEntry> where TEntry : class
+{
+    private const int FormatVersion = 1;
+
+    private static readonly JsonSerializerOptions JsonOptions = new()
+    {
+        WriteIndented = true,
+        Converters = { new JsonStringEnumConverter() }
+    };
+
+    private readonly SemaphoreSlim _fileLock = new(1, 1);
+    private readonly ILogger _logger;
+
+    public TuningStore(string path, ILogger logger)
+    {
+        Path = path;
+        _logger = logger;
+    }
+
+    public string Path { get; }
+
+    /// <summary>
+    /// Gets the default location of a store file, under the user's local application data
+    /// </summary>
+    public static string GetDefaultPath(string fileName)
+    {
+        var root = Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData);
+        if (string.IsNullOrEmpty(root))
+            root = System.IO.Path.GetTempPath();
+
+        return System.IO.Path.Combine(root, "Fluid.OpenVINO.GenAI", fileName);
+    }
+
+    public async Task<TEntry?> ReadAsync(string key, CancellationToken cancellationToken)
+    {
+        await _fileLock.WaitAsync(cancellationToken).ConfigureAwait(false);
+        try
+        {
+            var file = await ReadFileAsync(cancellationToken).ConfigureAwait(false);
+            return file.Entries.TryGetValue(key, out var entry) ? entry : null;
+        }
+        finally
+        {
+            _fileLock.Release();
+        }
+    }
+
+    public async Task WriteAsync(string key, TEntry entry, CancellationToken cancellationToken)
+    {
+        await _fileLock.WaitAsync(cancellationToken).ConfigureAwait(false);
+        var tempPath = Path + "." + Guid.NewGuid().ToString("N") + ".tmp";
+        try
+        {
+            var file = await ReadFileAsync(cancellationToken).ConfigureAwait(false);
+            file.Entries[key] = entry;
+
+            Directory.CreateDirectory(System.IO.Path.GetDirectoryName(System.IO.Path.GetFullPath(Path))!);
+            using (var stream = File.Create(tempPath))
+            {
+                await JsonSerializer.SerializeAsync(stream, file, JsonOptions, cancellationToken).ConfigureAwait(false);
+            }
+
+            // Readers never observe a partially written file
+            File.Move(tempPath, Path, overwrite: true);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            Log.TuningStoreWriteFailed(_logger, Path, ex);
+            try
+            {
+                File.Delete(tempPath);
+            }
+            catch (IOException)
+            {
+            }
+        }
+        finally
+        {
+            _fileLock.Release();
+        }
+    }
+
+    public void Clear()
+    {
+        _fileLock.Wait();
+        try
+        {
+            if (File.Exists(Path))
+            {
+                File.Delete(Path);
+            }
+        }
+        finally
+        {
+            _fileLock.Release();
+        }
+    }
+
+    private async Task<StoreFile> ReadFileAsync(CancellationToken cancellationToken)
+    {
+        if (!File.Exists(Path))
+            return new StoreFile();
+
+        try
+        {
+            using var stream = File.OpenRead(Path);
+            var file = await JsonSerializer.DeserializeAsync<StoreFile>(stream, JsonOptions, cancellationToken).ConfigureAwait(false);
+            if (file?.Version == FormatVersion && file.Entries != null)
+                return file;
+        }
+        catch (Exception ex) when (ex is IOException or JsonException or UnauthorizedAccessException)
+        {
+            Log.TuningStoreReadFailed(_logger, Path, ex);
+        }
+
+        return new StoreFile();
+    }
+
+    private sealed class StoreFile
+    {
+        public int Version { get; set; } = FormatVersion;
+
+        public Dictionary<string, TEntry> Entries { get; set; } = new(StringComparer.Ordinal);
+    }
+}
+
+/// <summary>
+/// Builds the keys of stored measurements: a hash of the model files, the host hardware and
+/// any settings that affect the result, so a stored entry is ignored once one of them changes
+/// </summary>
+internal sealed class TuningKey
+{
+    private readonly StringBuilder _builder = new();
+
+    public TuningKey(string modelPath)
+    {
+        var directory = new DirectoryInfo(modelPath);
+        Add("model", directory.FullName);
+        foreach (var file in directory.EnumerateFiles().OrderBy(f => f.Name, StringComparer.Ordinal))
+        {
+            Add(file.Name, $"{file.Length}:{file.LastWriteTimeUtc.Ticks.ToString(CultureInfo.InvariantCulture)}");
+        }
+
+        Add("os", RuntimeInformation.OSDescription);
+        Add("arch", RuntimeInformation.OSArchitecture.ToString());
+        Add("cores", Environment.ProcessorCount.ToString(CultureInfo.InvariantCulture));
+        Add("cpu", GetProcessorName());
+        Add("runtime", typeof(TuningKey).Assembly.GetName().Version?.ToString() ?? string.Empty);
+    }
+
+    public TuningKey Add(string name, string value)
+    {
+        _builder.Append(name).Append('=').Append(value).Append('\n');
+        return this;
+    }
+
+    public override string ToString()
+    {
+        var hash = new XxHash128();
+        hash.Append(Encoding.UTF8.GetBytes(_builder.ToString()));
+
+        Span<byte> digest = stackalloc byte[16];
+        hash.GetHashAndReset(digest);
+        return Convert.ToHexString(digest);
+    }
+
+    private static string GetProcessorName()
+    {
+        if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+            return Environment.GetEnvironmentVariable("PROCESSOR_IDENTIFIER") ?? string.Empty;
+
+        try
+        {
+            foreach (var line in File.ReadLines("/proc/cpuinfo"))
+            {
+                if (line.StartsWith("model name", StringComparison.Ordinal))
+                    return line.Substring(line.IndexOf(':') + 1).Trim();
+            }
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+        }
+
+        return string.Empty;
+    }
+}
@@ -0,0 +1,295 @@
+using System.Buffers;
+using System.Diagnostics;
+using System.IO.Pipelines;
+using System.Text;
+using System.Text.Encodings.Web;
+using System.Text.Json;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Writes UTF-8 tokens and Whisper chunks, framed as a <see cref="StreamFormat"/>, straight
+/// into the memory of a buffer writer
+/// </summary>
+/// <remarks>
+/// LLM tokens are written from the streaming callback on the inference thread, which never waits
+/// for a flush: while one is outstanding, tokens are kept in a backlog and written to the pipe once
+/// it completes. A reader that falls so far behind that the backlog fills up stops decoding. A flush
+/// starts once <see cref="GenerationOptions.FlushInterval"/> has passed since the previous one or
+/// enough bytes are pending, so fast decoding is sent in batches.
+/// </remarks>
+internal sealed class Utf8FrameWriter
+{
+    private const int MaxPendingBytes = 16 * 1024;
+    private const int MaxBacklogBytes = 1024 * 1024;
+
+    private static readonly JsonWriterOptions JsonOptions = new()
+    {
+        // Text is not embedded in HTML; keep non-ASCII characters readable
+        Encoder = JavaScriptEncoder.UnsafeRelaxedJsonEscaping,
+        SkipValidation = true
+    };
+
+    private static readonly byte[] DataPrefix = Encoding.UTF8.GetBytes("data: ");
+    private static readonly JsonEncodedText TokenProperty = JsonEncodedText.Encode("token");
+    private static readonly JsonEncodedText StartProperty = JsonEncodedText.Encode("start");
+    private static readonly JsonEncodedText EndProperty = JsonEncodedText.Encode("end");
+    private static readonly JsonEncodedText TextProperty = JsonEncodedText.Encode("text");
+
+    private readonly IBufferWriter<byte> _output;
+    private readonly PipeWriter? _pipe;
+    private readonly StreamFormat _format;
+    private readonly long _flushIntervalTicks;
+    private IBufferWriter<byte> _target;
+    private ArrayBufferWriter<byte>? _backlog;
+    private Task<FlushResult>? _flushing;
+    private Utf8JsonWriter? _json;
+    private long _lastFlush;
+    private long _pending;
+
+    public Utf8FrameWriter(IBufferWriter<byte> output, StreamFormat format, TimeSpan flushInterval)
+    {
+        _output = output;
+        _target = output;
+        _pipe = output as PipeWriter;
+        _format = format;
+        _flushIntervalTicks = (long)(flushInterval.TotalSeconds * Stopwatch.Frequency);
+        _lastFlush = Stopwatch.GetTimestamp();
+    }
+
+    /// <summary>
+    /// Gets the bytes written, including framing
+    /// </summary>
+    public long BytesWritten { get; private set; }
+
+    /// <summary>
+    /// Gets whether the pipe's reader has completed, so nothing more will be read
+    /// </summary>
+    public bool IsReaderCompleted { get; private set; }
+
+    /// <summary>
+    /// Gets whether decoding was stopped because the reader fell too far behind
+    /// </summary>
+    public bool IsReaderStalled { get; private set; }
+
+    /// <summary>
+    /// Writes one LLM token
+    /// </summary>
+    public void WriteToken(ReadOnlySpan<byte> utf8)
+    {
+        switch (_format)
+        {
+            case StreamFormat.Sse:
+                WriteEvent(utf8);
+                break;
+            case StreamFormat.Ndjson:
+                var json = GetJsonWriter();
+                json.WriteStartObject();
+                json.WriteString(TokenProperty, utf8);
+                json.WriteEndObject();
+                EndJsonLine(json);
+                break;
+            default:
+                Write(utf8);
+                break;
+        }
+    }
+
+    /// <summary>
+    /// Writes one Whisper chunk
+    /// </summary>
+    public void WriteChunk(WhisperChunk chunk)
+    {
+        if (_format == StreamFormat.Ndjson)
+        {
+            var json = GetJsonWriter();
+            json.WriteStartObject();
+            json.WriteNumber(StartProperty, chunk.StartTime);
+            json.WriteNumber(EndProperty, chunk.EndTime);
+            json.WriteString(TextProperty, chunk.Text);
+            json.WriteEndObject();
+            EndJsonLine(json);
+            return;
+        }
+
+        var maxLength = Encoding.UTF8.GetMaxByteCount(chunk.Text.Length);
+        if (_format == StreamFormat.Sse)
+        {
+            // Framing writes to the output, so encode the text elsewhere first
+            var buffer = ArrayPool<byte>.Shared.Rent(maxLength);
+            try
+            {
+                var encoded = Encoding.UTF8.GetBytes(chunk.Text.AsSpan(), buffer);
+                WriteEvent(buffer.AsSpan(0, encoded));
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+            return;
+        }
+
+        // Encode straight into the writer's memory
+        var length = Encoding.UTF8.GetBytes(chunk.Text.AsSpan(), _target.GetSpan(maxLength));
+        _target.Advance(length);
+        BytesWritten += length;
+        _pending += length;
+    }
+
+    /// <summary>
+    /// Starts a flush from the inference thread when the flush interval has passed or enough bytes
+    /// are pending, without waiting for it
+    /// </summary>
+    /// <param name="cancellationToken">Cancels the flush, e.g. when the request is canceled or the pipeline disposed</param>
+    /// <returns>False if decoding should stop: the reader completed or stalled, or a flush failed</returns>
+    public bool FlushIfDue(CancellationToken cancellationToken)
+    {
+        if (_pipe == null)
+            return true;
+
+        if (_flushing != null)
+        {
+            if (!_flushing.IsCompleted)
+            {
+                IsReaderStalled = _backlog!.WrittenCount > MaxBacklogBytes;
+                return !IsReaderStalled;
+            }
+
+            // A failed flush is rethrown by FlushAsync
+            if (!_flushing.IsCompletedSuccessfully)
+                return false;
+
+            EndFlush(_flushing.Result);
+        }
+
+        if (_pending == 0 || IsReaderCompleted)
+            return !IsReaderCompleted;
+
+        if (_pending < MaxPendingBytes && Stopwatch.GetTimestamp() - _lastFlush < _flushIntervalTicks)
+            return true;
+
+        StartFlush(cancellationToken);
+        return !IsReaderCompleted;
+    }
+
+    /// <summary>
+    /// Waits for an outstanding flush, then flushes whatever is pending
+    /// </summary>
+    public async ValueTask FlushAsync(CancellationToken cancellationToken)
+    {
+        if (_pipe == null)
+            return;
+
+        if (_flushing != null)
+            EndFlush(await _flushing.ConfigureAwait(false));
+
+        if (_pending == 0)
+            return;
+
+        _pending = 0;
+        _lastFlush = Stopwatch.GetTimestamp();
+        OnFlushed(await _pipe.FlushAsync(cancellationToken).ConfigureAwait(false));
+    }
+
+    private void StartFlush(CancellationToken cancellationToken)
+    {
+        _pending = 0;
+        _lastFlush = Stopwatch.GetTimestamp();
+
+        var flush = _pipe!.FlushAsync(cancellationToken);
+        if (flush.IsCompletedSuccessfully)
+        {
+            OnFlushed(flush.Result);
+            return;
+        }
+
+        // The pipe must not be written while it flushes; later bytes wait in the backlog
+        _flushing = flush.AsTask();
+        _flushing.ContinueWith(
+            static t => _ = t.Exception,
+            CancellationToken.None,
+            TaskContinuationOptions.OnlyOnFaulted | TaskContinuationOptions.ExecuteSynchronously,
+            TaskScheduler.Default);
+        _target = _backlog ??= new ArrayBufferWriter<byte>();
+    }
+
+    /// <summary>
+    /// Completes an outstanding flush and moves the backlog into the pipe; its bytes remain pending
+    /// </summary>
+    private void EndFlush(FlushResult result)
+    {
+        _flushing = null;
+        _target = _output;
+        OnFlushed(result);
+
+        var backlog = _backlog!.WrittenSpan;
+        if (!backlog.IsEmpty)
+        {
+            backlog.CopyTo(_output.GetSpan(backlog.Length));
+            _output.Advance(backlog.Length);
+            _backlog.Clear();
+        }
+    }
+
+    private void OnFlushed(FlushResult result)
+    {
+        IsReaderCompleted = result.IsCompleted;
+    }
+
+    /// <summary>
+    /// Writes a server-sent event; each line of the text becomes a data line, as line breaks would end the field
+    /// </summary>
+    private void WriteEvent(ReadOnlySpan<byte> utf8)
+    {
+        while (true)
+        {
+            var end = utf8.IndexOfAny((byte)'\r', (byte)'\n');
+            Write(DataPrefix);
+            Write(end < 0 ? utf8 : utf8.Slice(0, end));
+            WriteByte((byte)'\n');
+            if (end < 0)
+                break;
+
+            var next = utf8[end] == '\r' && end + 1 < utf8.Length && utf8[end + 1] == '\n' ? end + 2 : end + 1;
+            utf8 = utf8.Slice(next);
+        }
+
+        WriteByte((byte)'\n');
+    }
+
+    private Utf8JsonWriter GetJsonWriter()
+    {
+        if (_json == null)
+            _json = new Utf8JsonWriter(_target, JsonOptions);
+        else
+            _json.Reset(_target);
+        return _json;
+    }
+
+    private void EndJsonLine(Utf8JsonWriter json)
+    {
+        json.Flush();
+        BytesWritten += json.BytesCommitted;
+        _pending += json.BytesCommitted;
+        WriteByte((byte)'\n');
+    }
+
+    private void Write(ReadOnlySpan<byte> bytes)
+    {
+        if (bytes.IsEmpty)
+            return;
+
+        bytes.CopyTo(_target.GetSpan(bytes.Length));
+        _target.Advance(bytes.Length);
+        BytesWritten += bytes.Length;
+        _pending += bytes.Length;
+    }
+
+    private void WriteByte(byte value)
+    {
+        _target.GetSpan(1)[0] = value;
+        _target.Advance(1);
+        BytesWritten++;
+        _pending++;
+    }
+}
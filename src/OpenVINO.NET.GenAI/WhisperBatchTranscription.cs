@@ -0,0 +1,185 @@
+using System.Runtime.CompilerServices;
+using System.Threading.Channels;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Result of transcribing one source in a batch
+/// </summary>
+public sealed class WhisperBatchResult
+{
+    internal WhisperBatchResult(int index, AudioSource source, IReadOnlyList<WhisperDecodedResult>? results, Exception? error)
+    {
+        Index = index;
+        Source = source;
+        Results = results;
+        Error = error;
+    }
+
+    /// <summary>
+    /// Gets the position of the source in the input sequence
+    /// </summary>
+    public int Index { get; }
+
+    /// <summary>
+    /// Gets the source that was transcribed
+    /// </summary>
+    public AudioSource Source { get; }
+
+    /// <summary>
+    /// Gets the decoded results, or null if transcription failed
+    /// </summary>
+    public IReadOnlyList<WhisperDecodedResult>? Results { get; }
+
+    /// <summary>
+    /// Gets the error that occurred while loading or transcribing the source, if any
+    /// </summary>
+    public Exception? Error { get; }
+
+    /// <summary>
+    /// Gets a value indicating whether the source was transcribed successfully
+    /// </summary>
+    public bool IsSuccess => Error == null;
+}
+
+/// <summary>
+/// Extension methods for pools of Whisper pipelines
+/// </summary>
+public static class WhisperPipelinePoolExtensions
+{
+    /// <summary>
+    /// Transcribes many audio sources across all replicas of the pool, yielding each result as soon as it finishes
+    /// </summary>
+    /// <param name="pool">The pool of Whisper pipelines</param>
+    /// <param name="sources">Audio sources to transcribe</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Per-source results in completion order</returns>
+    public static IAsyncEnumerable<WhisperBatchResult> TranscribeBatchAsync(
+        this PipelinePool<WhisperPipeline> pool,
+        IEnumerable<AudioSource> sources,
+        WhisperGenerationConfig? config = null,
+        CancellationToken cancellationToken = default)
+    {
+        if (pool == null)
+            throw new ArgumentNullException(nameof(pool));
+        if (sources == null)
+            throw new ArgumentNullException(nameof(sources));
+
+        return WhisperBatchScheduler.RunAsync(pool, sources, config, cancellationToken);
+    }
+}
+
+/// <summary>
+/// Schedules batch transcription across the replicas of a pool. Audio for upcoming
+/// sources is loaded while earlier sources are being transcribed.
+/// </summary>
+internal static class WhisperBatchScheduler
+{
+    internal static async IAsyncEnumerable<WhisperBatchResult> RunAsync(
+        PipelinePool<WhisperPipeline> pool,
+        IEnumerable<AudioSource> sources,
+        WhisperGenerationConfig? config,
+        [EnumeratorCancellation] CancellationToken cancellationToken)
+    {
+        var workerCount = pool.Size;
+
+        // Stops loading and transcription if the consumer stops enumerating early
+        using var cts = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+        var token = cts.Token;
+
+        // Bounded so that loading runs at most one source ahead per replica
+        var loaded = Channel.CreateBounded<(int Index, AudioSource Source, float[] Samples)>(
+            new BoundedChannelOptions(workerCount) { SingleWriter = true });
+        var output = Channel.CreateUnbounded<WhisperBatchResult>(
+            new UnboundedChannelOptions { SingleReader = true });
+
+        var loader = Task.Run(async () =>
+        {
+            try
+            {
+                var index = 0;
+                foreach (var source in sources)
+                {
+                    token.ThrowIfCancellationRequested();
+
+                    var current = index++;
+                    float[] samples;
+                    try
+                    {
+                        samples = await source.LoadAsync(token);
+                    }
+                    catch (Exception ex) when (ex is not OperationCanceledException)
+                    {
+                        output.Writer.TryWrite(new WhisperBatchResult(current, source, null, ex));
+                        continue;
+                    }
+
+                    await loaded.Writer.WriteAsync((current, source, samples), token);
+                }
+            }
+            finally
+            {
+                loaded.Writer.TryComplete();
+            }
+        }, token);
+
+        var workers = new Task[workerCount];
+        for (int i = 0; i < workerCount; i++)
+        {
+            workers[i] = Task.Run(async () =>
+            {
+                await foreach (var (index, source, samples) in loaded.Reader.ReadAllAsync(token))
+                {
+                    using var lease = await pool.RentAsync(token);
+
+                    WhisperBatchResult result;
+                    try
+                    {
+                        var results = await lease.Pipeline.GenerateAsync(samples, config, token);
+                        result = new WhisperBatchResult(index, source, results, null);
+                    }
+                    catch (Exception ex) when (ex is not OperationCanceledException)
+                    {
+                        result = new WhisperBatchResult(index, source, null, ex);
+                    }
+
+                    output.Writer.TryWrite(result);
+                }
+            }, token);
+        }
+
+        var completion = Task.WhenAll(workers.Append(loader));
+        _ = completion.ContinueWith(
+            _ => output.Writer.TryComplete(),
+            CancellationToken.None,
+            TaskContinuationOptions.ExecuteSynchronously,
+            TaskScheduler.Default);
+
+        try
+        {
+            // Yield results as they finish
+            await foreach (var result in output.Reader.ReadAllAsync(cancellationToken))
+            {
+                yield return result;
+            }
+
+            // Surface loader/worker failures such as cancellation
+            await completion;
+        }
+        finally
+        {
+            if (!completion.IsCompleted)
+            {
+                cts.Cancel();
+                try
+                {
+                    await completion;
+                }
+                catch (OperationCanceledException)
+                {
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+using System.Text;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Struct-of-arrays storage for Whisper chunks: start/end spans plus a single
+/// UTF-8 text arena with offsets. Chunk objects are only created on demand.
+/// </summary>
+internal sealed class WhisperChunkBuffer
+{
+    private float[] _startTimes;
+    private float[] _endTimes;
+    private int[] _textOffsets;
+    private byte[] _textArena;
+    private int _count;
+    private int _arenaLength;
+
+    /// <summary>
+    /// Initializes a new instance of the WhisperChunkBuffer class
+    /// </summary>
+    /// <param name="capacity">Expected number of chunks</param>
+    /// <param name="arenaCapacity">Expected total UTF-8 text size in bytes</param>
+    public WhisperChunkBuffer(int capacity, int arenaCapacity = 0)
+    {
+        capacity = Math.Max(capacity, 1);
+        _startTimes = new float[capacity];
+        _endTimes = new float[capacity];
+        _textOffsets = new int[capacity + 1];
+        _textArena = new byte[Math.Max(arenaCapacity, capacity * 32)];
+    }
+
+    /// <summary>
+    /// Gets the number of chunks
+    /// </summary>
+    public int Count => _count;
+
+    /// <summary>
+    /// Gets the start timestamps of all chunks in seconds
+    /// </summary>
+    public ReadOnlySpan<float> StartTimes => _startTimes.AsSpan(0, _count);
+
+    /// <summary>
+    /// Gets the end timestamps of all chunks in seconds
+    /// </summary>
+    public ReadOnlySpan<float> EndTimes => _endTimes.AsSpan(0, _count);
+
+    /// <summary>
+    /// Gets the UTF-8 text of the chunk at the given index
+    /// </summary>
+    public ReadOnlySpan<byte> GetUtf8Text(int index)
+    {
+        if ((uint)index >= (uint)_count)
+            throw new ArgumentOutOfRangeException(nameof(index));
+
+        var start = _textOffsets[index];
+        return _textArena.AsSpan(start, _textOffsets[index + 1] - start);
+    }
+
+    /// <summary>
+    /// Decodes the text of the chunk at the given index
+    /// </summary>
+    public string GetText(int index) => Encoding.UTF8.GetString(GetUtf8Text(index));
+
+    /// <summary>
+    /// Appends a chunk
+    /// </summary>
+    /// <param name="startTime">Start timestamp in seconds</param>
+    /// <param name="endTime">End timestamp in seconds</param>
+    /// <param name="utf8Text">Chunk text as UTF-8 bytes (without terminator)</param>
+    public void Add(float startTime, float endTime, ReadOnlySpan<byte> utf8Text)
+    {
+        if (_count == _startTimes.Length)
+        {
+            var newCapacity = _count * 2;
+            Array.Resize(ref _startTimes, newCapacity);
+            Array.Resize(ref _endTimes, newCapacity);
+            Array.Resize(ref _textOffsets, newCapacity + 1);
+        }
+
+        if (_arenaLength + utf8Text.Length > _textArena.Length)
+        {
+            Array.Resize(ref _textArena, Math.Max(_textArena.Length * 2, _arenaLength + utf8Text.Length));
+        }
+
+        utf8Text.CopyTo(_textArena.AsSpan(_arenaLength));
+        _arenaLength += utf8Text.Length;
+
+        _startTimes[_count] = startTime;
+        _endTimes[_count] = endTime;
+        _count++;
+        _textOffsets[_count] = _arenaLength;
+    }
+
+    /// <summary>
+    /// Writes the buffer in its compact form
+    /// </summary>
+    public void WriteTo(BinaryWriter writer)
+    {
+        writer.Write(_count);
+        for (int i = 0; i < _count; i++)
+        {
+            writer.Write(_startTimes[i]);
+            writer.Write(_endTimes[i]);
+            writer.Write(_textOffsets[i + 1]);
+        }
+        writer.Write(_arenaLength);
+        writer.Write(_textArena, 0, _arenaLength);
+    }
+
+    /// <summary>
+    /// Reads a buffer written by <see cref="WriteTo"/>
+    /// </summary>
+    public static WhisperChunkBuffer ReadFrom(BinaryReader reader)
+    {
+        // Each chunk is a start time, an end time and a text offset
+        var count = CachedTranscription.ReadCount(reader, sizeof(float) * 2 + sizeof(int));
+        var buffer = new WhisperChunkBuffer(count);
+        for (int i = 0; i < count; i++)
+        {
+            buffer._startTimes[i] = reader.ReadSingle();
+            buffer._endTimes[i] = reader.ReadSingle();
+            buffer._textOffsets[i + 1] = reader.ReadInt32();
+        }
+
+        var arenaLength = CachedTranscription.ReadCount(reader, 1);
+        for (int i = 0; i < count; i++)
+        {
+            if (buffer._textOffsets[i + 1] < buffer._textOffsets[i])
+                throw new InvalidDataException("Chunk text offsets are not ordered");
+        }
+        if (buffer._textOffsets[count] != arenaLength)
+            throw new InvalidDataException("Chunk text offsets do not match the text size");
+
+        if (arenaLength > buffer._textArena.Length)
+            buffer._textArena = new byte[arenaLength];
+        if (reader.Read(buffer._textArena, 0, arenaLength) != arenaLength)
+            throw new EndOfStreamException();
+
+        buffer._count = count;
+        buffer._arenaLength = arenaLength;
+        return buffer;
+    }
+
+    /// <summary>
+    /// Materializes the chunks as <see cref="WhisperChunk"/> objects
+    /// </summary>
+    public IReadOnlyList<WhisperChunk> ToChunks()
+    {
+        var chunks = new WhisperChunk[_count];
+        for (int i = 0; i < _count; i++)
+        {
+            chunks[i] = new WhisperChunk(_startTimes[i], _endTimes[i], GetText(i));
+        }
+        return chunks;
+    }
+}
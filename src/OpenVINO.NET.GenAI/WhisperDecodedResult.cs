@@ -5,6 +5,11 @@ namespace Fluid.OpenVINO.GenAI;
 /// </summary>
 public sealed class WhisperDecodedResult
 {
+    private readonly WhisperChunkBuffer? _chunkBuffer;
+    private IReadOnlyList<WhisperChunk>? _chunks;
+    private readonly bool _estimateWords;
+    private WhisperWordCollection? _words;
+
     /// <summary>
     /// Gets the transcribed text
     /// </summary>
@@ -18,7 +23,21 @@ public sealed class WhisperDecodedResult
     /// <summary>
     /// Gets the timestamped chunks if available
     /// </summary>
-    public IReadOnlyList<WhisperChunk>? Chunks { get; }
+    /// <remarks>
+    /// Results produced by <see cref="WhisperPipeline"/> keep chunks in a compact
+    /// buffer and only create <see cref="WhisperChunk"/> objects on first access.
+    /// </remarks>
+    public IReadOnlyList<WhisperChunk>? Chunks
+    {
+        get
+        {
+            if (_chunks == null && _chunkBuffer != null)
+            {
+                _chunks = _chunkBuffer.ToChunks();
+            }
+            return _chunks;
+        }
+    }
 
     /// <summary>
     /// Initializes a new instance of the WhisperDecodedResult class
@@ -30,13 +49,71 @@ public sealed class WhisperDecodedResult
     {
         Text = text ?? throw new ArgumentNullException(nameof(text));
         Score = score;
-        Chunks = chunks;
+        _chunks = chunks;
     }
 
+    /// <summary>
+    /// Internal constructor from extracted native chunk data
+    /// </summary>
+    /// <param name="text">The transcribed text</param>
+    /// <param name="score">The confidence score</param>
+    /// <param name="chunkBuffer">Chunk data shared by all results of one generation</param>
+    /// <param name="performanceMetrics">Metrics shared by all results of one generation</param>
+    /// <param name="estimateWords">Whether estimated word timings were requested</param>
+    internal WhisperDecodedResult(
+        string text,
+        float score,
+        WhisperChunkBuffer? chunkBuffer,
+        WhisperPerformanceMetrics? performanceMetrics,
+        bool estimateWords)
+    {
+        Text = text;
+        Score = score;
+        _chunkBuffer = chunkBuffer;
+        _estimateWords = estimateWords;
+        PerformanceMetrics = performanceMetrics;
+    }
+
+    /// <summary>
+    /// Gets the words with estimated timings if requested with <see cref="WhisperGenerationConfig.WithEstimatedWordTimings"/>
+    /// </summary>
+    /// <remarks>
+    /// These are not word timestamps from the model: the C API exposes no cross-attention
+    /// alignment, so each word's times are interpolated inside its timestamped segment.
+    /// Words are computed from the chunk buffer on first access and stored as flat arrays
+    /// over one shared transcript string rather than one object per word.
+    /// </remarks>
+    public WhisperWordCollection? EstimatedWords
+    {
+        get
+        {
+            if (_words == null && _estimateWords && _chunkBuffer != null)
+            {
+                _words = WhisperWordCollection.FromChunks(_chunkBuffer);
+            }
+            return _words;
+        }
+    }
+
+    /// <summary>
+    /// Gets the performance metrics of the transcription that produced this result, if available
+    /// </summary>
+    public WhisperPerformanceMetrics? PerformanceMetrics { get; }
+
     /// <summary>
     /// Gets a value indicating whether this result has timestamped chunks
     /// </summary>
-    public bool HasChunks => Chunks != null && Chunks.Count > 0;
+    public bool HasChunks => _chunkBuffer != null ? _chunkBuffer.Count > 0 : _chunks != null && _chunks.Count > 0;
+
+    /// <summary>
+    /// Gets the number of timestamped chunks without materializing them
+    /// </summary>
+    public int ChunkCount => _chunkBuffer?.Count ?? _chunks?.Count ?? 0;
+
+    /// <summary>
+    /// Gets the compact chunk storage, if this result was produced by the pipeline
+    /// </summary>
+    internal WhisperChunkBuffer? ChunkBuffer => _chunkBuffer;
 }
 
 /// <summary>
@@ -0,0 +1,143 @@
+using System.Globalization;
+using System.IO.Compression;
+using System.Text;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Decoding options that are applied by the managed pipeline rather than by the native
+/// Whisper config: estimated word timings, the silence gate and temperature fallback. Also
+/// records the native settings applied to a config, since the C API cannot read most of them back.
+/// </summary>
+internal sealed class WhisperDecodingOptions
+{
+    private SortedDictionary<string, string> _settings = new(StringComparer.Ordinal);
+    private Dictionary<string, Action<WhisperGenerationConfig>> _replay = new(StringComparer.Ordinal);
+
+    /// <summary>
+    /// Gets or sets whether words with interpolated timings are requested
+    /// </summary>
+    public bool EstimatedWordTimings { get; set; }
+
+    /// <summary>
+    /// Gets or sets whether timestamps are on only because estimated word timings turned them on
+    /// </summary>
+    public bool TimestampsForWordTimings { get; set; }
+
+    /// <summary>
+    /// Gets or sets the RMS level in dBFS below which a window is treated as silence
+    /// </summary>
+    public float? SilenceThresholdDbfs { get; set; }
+
+    /// <summary>
+    /// Gets or sets the text compression ratio above which a window is decoded again
+    /// </summary>
+    public float? CompressionRatioThreshold { get; set; }
+
+    /// <summary>
+    /// Gets or sets the sampling temperatures tried in order when a window fails the compression check
+    /// </summary>
+    public float[]? TemperatureFallback { get; set; }
+
+    /// <summary>
+    /// Gets whether the audio must be decoded window by window to apply these options
+    /// </summary>
+    public bool RequiresWindowedDecoding => SilenceThresholdDbfs.HasValue || CompressionRatioThreshold.HasValue;
+
+    /// <summary>
+    /// Creates options for a config whose initial settings come from the given source
+    /// </summary>
+    /// <param name="source">Identifies the initial settings, e.g. "default" or "model"</param>
+    public static WhisperDecodingOptions FromSource(string source)
+    {
+        var options = new WhisperDecodingOptions();
+        options.Record("source", source);
+        return options;
+    }
+
+    /// <summary>
+    /// Creates a copy of these options
+    /// </summary>
+    public WhisperDecodingOptions Clone()
+    {
+        var clone = (WhisperDecodingOptions)MemberwiseClone();
+        clone._settings = new SortedDictionary<string, string>(_settings, StringComparer.Ordinal);
+        clone._replay = new Dictionary<string, Action<WhisperGenerationConfig>>(_replay, StringComparer.Ordinal);
+        return clone;
+    }
+
+    /// <summary>
+    /// Records a native setting so it becomes part of the <see cref="Fingerprint"/>
+    /// </summary>
+    /// <param name="key">Setting name</param>
+    /// <param name="value">Setting value</param>
+    /// <param name="apply">Applies the setting again to a copy of the config</param>
+    public void Record(string key, string value, Action<WhisperGenerationConfig>? apply = null)
+    {
+        _settings[key] = value;
+        if (apply != null)
+            _replay[key] = apply;
+    }
+
+    /// <summary>
+    /// Records a numeric native setting using invariant formatting
+    /// </summary>
+    public void Record(string key, IFormattable value, Action<WhisperGenerationConfig>? apply = null)
+        => Record(key, value.ToString(null, CultureInfo.InvariantCulture), apply);
+
+    /// <summary>
+    /// Applies the recorded native settings to a config created from the same source
+    /// </summary>
+    public void Replay(WhisperGenerationConfig config)
+    {
+        foreach (var apply in _replay.Values)
+        {
+            apply(config);
+        }
+    }
+
+    /// <summary>
+    /// Gets a string that identifies all recorded settings and managed options
+    /// </summary>
+    public string Fingerprint
+    {
+        get
+        {
+            var builder = new StringBuilder();
+            foreach (var setting in _settings)
+            {
+                builder.Append(setting.Key).Append('=').Append(setting.Value).Append('\n');
+            }
+
+            builder.Append("estimated_word_timings=").Append(EstimatedWordTimings).Append('\n');
+            builder.Append("silence_threshold_dbfs=").Append(SilenceThresholdDbfs?.ToString(CultureInfo.InvariantCulture)).Append('\n');
+            builder.Append("compression_ratio_threshold=").Append(CompressionRatioThreshold?.ToString(CultureInfo.InvariantCulture)).Append('\n');
+            if (TemperatureFallback != null)
+            {
+                builder.Append("temperature_fallback=")
+                    .Append(string.Join(",", TemperatureFallback.Select(t => t.ToString(CultureInfo.InvariantCulture))))
+                    .Append('\n');
+            }
+
+            return builder.ToString();
+        }
+    }
+
+    /// <summary>
+    /// Computes the ratio of UTF-8 size to compressed size; repetitive (hallucinated) text compresses well
+    /// </summary>
+    public static float CompressionRatio(string text)
+    {
+        if (string.IsNullOrEmpty(text))
+            return 0;
+
+        var bytes = Encoding.UTF8.GetBytes(text);
+        using var compressed = new MemoryStream();
+        using (var deflate = new DeflateStream(compressed, CompressionLevel.Optimal, leaveOpen: true))
+        {
+            deflate.Write(bytes, 0, bytes.Length);
+        }
+
+        return compressed.Length > 0 ? (float)bytes.Length / compressed.Length : 0;
+    }
+}
@@ -1,3 +1,4 @@
+using System.IO.Hashing;
 using Fluid.OpenVINO.GenAI.Exceptions;
 using Fluid.OpenVINO.GenAI.Native;
 using Fluid.OpenVINO.GenAI.SafeHandles;
@@ -10,6 +11,7 @@ namespace Fluid.OpenVINO.GenAI;
 public sealed class WhisperGenerationConfig : IDisposable
 {
     private readonly WhisperGenerationConfigSafeHandle _handle;
+    private readonly Func<WhisperGenerationConfigSafeHandle> _createHandle;
     private bool _disposed;
 
     /// <summary>
@@ -20,9 +22,10 @@ public sealed class WhisperGenerationConfig : IDisposable
         // Ensure native libraries are loaded before any P/Invoke calls
         NativeLibraryLoader.EnsureLoaded();
 
-        var status = GenAINativeMethods.ov_genai_whisper_generation_config_create(out var handle);
-        OpenVINOGenAIException.ThrowIfError(status, "create whisper generation config");
-        _handle = new WhisperGenerationConfigSafeHandle(handle, true);
+        _createHandle = CreateDefaultHandle;
+        _handle = _createHandle();
+
+        Options = WhisperDecodingOptions.FromSource("default");
     }
 
     /// <summary>
@@ -37,24 +40,34 @@ public sealed class WhisperGenerationConfig : IDisposable
         // Ensure native libraries are loaded before any P/Invoke calls
         NativeLibraryLoader.EnsureLoaded();
 
-        var status = GenAINativeMethods.ov_genai_whisper_generation_config_create_from_json(jsonPath, out var handle);
-        OpenVINOGenAIException.ThrowIfError(status, "create whisper generation config from JSON");
-        _handle = new WhisperGenerationConfigSafeHandle(handle, true);
+        var json = new FileInfo(jsonPath);
+        _createHandle = () => CreateHandleFromJson(json.FullName);
+        _handle = _createHandle();
+
+        // The file content, not its path, decides the settings the config starts from
+        Options = WhisperDecodingOptions.FromSource("json:" + Convert.ToHexString(XxHash128.Hash(File.ReadAllBytes(json.FullName))));
     }
 
     /// <summary>
     /// Internal constructor from existing handle
     /// </summary>
     /// <param name="handle">Existing native handle</param>
-    internal WhisperGenerationConfig(WhisperGenerationConfigSafeHandle handle)
+    /// <param name="options">Managed options and settings record to start from</param>
+    /// <param name="createHandle">Creates another handle in the same initial state, for copies</param>
+    internal WhisperGenerationConfig(
+        WhisperGenerationConfigSafeHandle handle,
+        WhisperDecodingOptions? options,
+        Func<WhisperGenerationConfigSafeHandle> createHandle)
     {
         _handle = handle;
+        _createHandle = createHandle;
+        Options = options?.Clone() ?? new WhisperDecodingOptions();
     }
 
     /// <summary>
-    /// Gets the native handle
+    /// Gets the native handle; native calls hold a <see cref="HandleReference"/> on it
     /// </summary>
-    internal IntPtr Handle => _handle.DangerousGetHandle();
+    internal WhisperGenerationConfigSafeHandle Handle => _handle;
 
     /// <summary>
     /// Gets the default whisper generation configuration
@@ -64,7 +77,7 @@ public sealed class WhisperGenerationConfig : IDisposable
     /// <summary>
     /// Sets the language for transcription
     /// </summary>
-    /// <param name="language">Language code (e.g., "en", "es", "fr")</param>
+    /// <param name="language">Language code (e.g., "en", "es", "fr") or language token (e.g., "&lt;|en|&gt;")</param>
     /// <returns>This configuration instance for fluent chaining</returns>
     public WhisperGenerationConfig WithLanguage(string language)
     {
@@ -72,8 +85,11 @@ public sealed class WhisperGenerationConfig : IDisposable
         if (string.IsNullOrEmpty(language))
             throw new ArgumentException("Language cannot be null or empty", nameof(language));
 
-        var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_language(_handle.DangerousGetHandle(), language);
+        // The native config expects the language token form
+        var token = WhisperLanguageDetectionResult.ToLanguageToken(language);
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_language(_handle.DangerousGetHandle(), token);
         OpenVINOGenAIException.ThrowIfError(status, "set language");
+        Options.Record("language", token, c => c.WithLanguage(token));
         return this;
     }
 
@@ -89,6 +105,7 @@ public sealed class WhisperGenerationConfig : IDisposable
 
         var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_task(_handle.DangerousGetHandle(), taskString);
         OpenVINOGenAIException.ThrowIfError(status, "set task");
+        Options.Record("task", taskString, c => c.WithTask(task));
         return this;
     }
 
@@ -103,9 +120,89 @@ public sealed class WhisperGenerationConfig : IDisposable
 
         var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_return_timestamps(_handle.DangerousGetHandle(), returnTimestamps);
         OpenVINOGenAIException.ThrowIfError(status, "set return timestamps");
+        Options.Record("return_timestamps", returnTimestamps ? "true" : "false", c => c.WithTimestamps(returnTimestamps));
+        Options.TimestampsForWordTimings = false;
         return this;
     }
 
+    /// <summary>
+    /// Sets whether to return words with estimated timings in <see cref="WhisperDecodedResult.EstimatedWords"/>
+    /// </summary>
+    /// <remarks>
+    /// These are not word timestamps: the GenAI C API does not expose cross-attention
+    /// alignment, so each segment's time range is split across its words in proportion to
+    /// their length. Enabling this enables timestamps; disabling it turns them off again
+    /// unless they were enabled with <see cref="WithTimestamps"/>.
+    /// </remarks>
+    /// <param name="estimate">True to return estimated word timings, false otherwise</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithEstimatedWordTimings(bool estimate = true)
+    {
+        ThrowIfDisposed();
+
+        if (estimate && !GetReturnTimestamps())
+        {
+            WithTimestamps(true);
+            Options.TimestampsForWordTimings = true;
+        }
+        else if (!estimate && Options.TimestampsForWordTimings)
+        {
+            WithTimestamps(false);
+        }
+
+        Options.EstimatedWordTimings = estimate;
+        return this;
+    }
+
+    /// <summary>
+    /// Gets the options applied by the managed pipeline
+    /// </summary>
+    internal WhisperDecodingOptions Options { get; private set; } = new();
+
+    /// <summary>
+    /// Creates an independent copy with the same native settings and managed options
+    /// </summary>
+    /// <remarks>
+    /// The C API cannot copy a config, so the copy is created from the same source and the
+    /// recorded settings are applied to it again.
+    /// </remarks>
+    internal WhisperGenerationConfig Clone()
+    {
+        ThrowIfDisposed();
+
+        var clone = new WhisperGenerationConfig(_createHandle(), null, _createHandle);
+        try
+        {
+            Options.Replay(clone);
+        }
+        catch
+        {
+            clone.Dispose();
+            throw;
+        }
+
+        clone.Options = Options.Clone();
+        return clone;
+    }
+
+    /// <summary>
+    /// Gets a string that identifies the effective settings, used as part of cache keys
+    /// </summary>
+    /// <remarks>
+    /// Combines the source the config was created from, every setting applied through this
+    /// instance and the values the C API can read back.
+    /// </remarks>
+    internal string Fingerprint
+    {
+        get
+        {
+            ThrowIfDisposed();
+
+            return Options.Fingerprint + FormattableString.Invariant(
+                $"max_new_tokens={GetMaxNewTokens()}\nreturn_timestamps={GetReturnTimestamps()}\nmax_initial_timestamp_index={GetMaxInitialTimestampIndex()}\n");
+        }
+    }
+
     /// <summary>
     /// Sets the initial prompt to guide the transcription
     /// </summary>
@@ -119,6 +216,7 @@ public sealed class WhisperGenerationConfig : IDisposable
 
         var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_initial_prompt(_handle.DangerousGetHandle(), prompt);
         OpenVINOGenAIException.ThrowIfError(status, "set initial prompt");
+        Options.Record("initial_prompt", prompt, c => c.WithInitialPrompt(prompt));
         return this;
     }
 
@@ -135,9 +233,270 @@ public sealed class WhisperGenerationConfig : IDisposable
 
         var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_hotwords(_handle.DangerousGetHandle(), hotwords);
         OpenVINOGenAIException.ThrowIfError(status, "set hotwords");
+        Options.Record("hotwords", hotwords, c => c.WithHotwords(hotwords));
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the maximum number of new tokens to generate per 30 second window
+    /// </summary>
+    /// <param name="maxNewTokens">Maximum number of new tokens</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithMaxTokens(int maxNewTokens)
+    {
+        ThrowIfDisposed();
+        if (maxNewTokens < 0)
+            throw new ArgumentOutOfRangeException(nameof(maxNewTokens), "Max new tokens cannot be negative");
+
+        using var baseConfig = GetBaseConfig();
+        var status = GenAINativeMethods.ov_genai_generation_config_set_max_new_tokens(baseConfig.DangerousGetHandle(), (nuint)maxNewTokens);
+        OpenVINOGenAIException.ThrowIfError(status, "set max new tokens");
+        Options.Record("max_new_tokens", maxNewTokens, c => c.WithMaxTokens(maxNewTokens));
         return this;
     }
 
+    /// <summary>
+    /// Sets the number of beams for beam search (1 means greedy decoding)
+    /// </summary>
+    /// <param name="numBeams">Number of beams</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithNumBeams(int numBeams)
+    {
+        ThrowIfDisposed();
+        if (numBeams < 1)
+            throw new ArgumentOutOfRangeException(nameof(numBeams), "Number of beams must be at least 1");
+
+        using var baseConfig = GetBaseConfig();
+        var status = GenAINativeMethods.ov_genai_generation_config_set_num_beams(baseConfig.DangerousGetHandle(), (nuint)numBeams);
+        OpenVINOGenAIException.ThrowIfError(status, "set num beams");
+        Options.Record("num_beams", numBeams, c => c.WithNumBeams(numBeams));
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the length penalty for beam search
+    /// </summary>
+    /// <param name="lengthPenalty">Length penalty (values above 1.0 favor longer sequences)</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithLengthPenalty(float lengthPenalty)
+    {
+        ThrowIfDisposed();
+
+        using var baseConfig = GetBaseConfig();
+        var status = GenAINativeMethods.ov_genai_generation_config_set_length_penalty(baseConfig.DangerousGetHandle(), lengthPenalty);
+        OpenVINOGenAIException.ThrowIfError(status, "set length penalty");
+        Options.Record("length_penalty", lengthPenalty, c => c.WithLengthPenalty(lengthPenalty));
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the tokens that are suppressed at every decoding step
+    /// </summary>
+    /// <param name="tokenIds">Token IDs to suppress</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithSuppressTokens(params long[] tokenIds)
+    {
+        ThrowIfDisposed();
+        if (tokenIds == null)
+            throw new ArgumentNullException(nameof(tokenIds));
+
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_suppress_tokens(_handle.DangerousGetHandle(), tokenIds, (nuint)tokenIds.Length);
+        OpenVINOGenAIException.ThrowIfError(status, "set suppress tokens");
+        var suppressed = (long[])tokenIds.Clone();
+        Options.Record("suppress_tokens", string.Join(",", suppressed), c => c.WithSuppressTokens(suppressed));
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the tokens that are suppressed at the first decoding step
+    /// </summary>
+    /// <param name="tokenIds">Token IDs to suppress</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithBeginSuppressTokens(params long[] tokenIds)
+    {
+        ThrowIfDisposed();
+        if (tokenIds == null)
+            throw new ArgumentNullException(nameof(tokenIds));
+
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_begin_suppress_tokens(_handle.DangerousGetHandle(), tokenIds, (nuint)tokenIds.Length);
+        OpenVINOGenAIException.ThrowIfError(status, "set begin suppress tokens");
+        var suppressed = (long[])tokenIds.Clone();
+        Options.Record("begin_suppress_tokens", string.Join(",", suppressed), c => c.WithBeginSuppressTokens(suppressed));
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the latest timestamp token index allowed as the first timestamp
+    /// </summary>
+    /// <param name="index">Maximum initial timestamp index (each step is 0.02 seconds)</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithMaxInitialTimestampIndex(int index)
+    {
+        ThrowIfDisposed();
+        if (index < 0)
+            throw new ArgumentOutOfRangeException(nameof(index), "Max initial timestamp index cannot be negative");
+
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_set_max_initial_timestamp_index(_handle.DangerousGetHandle(), (nuint)index);
+        OpenVINOGenAIException.ThrowIfError(status, "set max initial timestamp index");
+        Options.Record("max_initial_timestamp_index", index, c => c.WithMaxInitialTimestampIndex(index));
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the energy level below which a 30 second window is skipped as silence
+    /// </summary>
+    /// <remarks>
+    /// This is an energy gate on the audio, not Whisper's no-speech probability, which the
+    /// GenAI C API does not report: windows whose RMS level is below
+    /// <paramref name="thresholdDbfs"/> are not decoded, whatever they contain. Setting a
+    /// threshold makes the pipeline decode the audio window by window.
+    /// </remarks>
+    /// <param name="thresholdDbfs">RMS level in dBFS (e.g., -50)</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithSilenceThreshold(float thresholdDbfs)
+    {
+        ThrowIfDisposed();
+        if (thresholdDbfs > 0)
+            throw new ArgumentOutOfRangeException(nameof(thresholdDbfs), "Threshold must be at most 0 dBFS");
+
+        Options.SilenceThresholdDbfs = thresholdDbfs;
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the text compression ratio above which a window is considered repetitive and decoded again
+    /// </summary>
+    /// <remarks>
+    /// Windows that fail the check are decoded again with each temperature from
+    /// <see cref="WithTemperatureFallback"/> until one passes. Setting a threshold makes
+    /// the pipeline decode the audio window by window.
+    /// </remarks>
+    /// <param name="threshold">Compression ratio threshold (e.g., 2.4)</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithCompressionRatioThreshold(float threshold)
+    {
+        ThrowIfDisposed();
+        if (threshold <= 0)
+            throw new ArgumentOutOfRangeException(nameof(threshold), "Compression ratio threshold must be positive");
+
+        Options.CompressionRatioThreshold = threshold;
+        return this;
+    }
+
+    /// <summary>
+    /// Sets the sampling temperatures tried in order when a window fails the compression ratio check
+    /// </summary>
+    /// <param name="temperatures">Temperatures (e.g., 0.2, 0.4, 0.6, 0.8, 1.0)</param>
+    /// <returns>This configuration instance for fluent chaining</returns>
+    public WhisperGenerationConfig WithTemperatureFallback(params float[] temperatures)
+    {
+        ThrowIfDisposed();
+        if (temperatures == null)
+            throw new ArgumentNullException(nameof(temperatures));
+        if (temperatures.Any(t => t <= 0))
+            throw new ArgumentOutOfRangeException(nameof(temperatures), "Fallback temperatures must be positive");
+
+        Options.TemperatureFallback = (float[])temperatures.Clone();
+        return this;
+    }
+
+    /// <summary>
+    /// Gets the silence threshold in dBFS, if set
+    /// </summary>
+    public float? SilenceThresholdDbfs => Options.SilenceThresholdDbfs;
+
+    /// <summary>
+    /// Gets the compression ratio threshold, if set
+    /// </summary>
+    public float? CompressionRatioThreshold => Options.CompressionRatioThreshold;
+
+    /// <summary>
+    /// Gets the fallback temperatures, if set
+    /// </summary>
+    public IReadOnlyList<float>? TemperatureFallback => Options.TemperatureFallback;
+
+    /// <summary>
+    /// Gets the maximum number of new tokens
+    /// </summary>
+    /// <returns>Maximum number of new tokens</returns>
+    public int GetMaxNewTokens()
+    {
+        ThrowIfDisposed();
+
+        using var baseConfig = GetBaseConfig();
+        var status = GenAINativeMethods.ov_genai_generation_config_get_max_new_tokens(baseConfig.DangerousGetHandle(), out var maxNewTokens);
+        OpenVINOGenAIException.ThrowIfError(status, "get max new tokens");
+        return (int)Math.Min(maxNewTokens, (nuint)int.MaxValue);
+    }
+
+    /// <summary>
+    /// Gets whether timestamps are returned
+    /// </summary>
+    /// <returns>True if timestamps are returned</returns>
+    public bool GetReturnTimestamps()
+    {
+        ThrowIfDisposed();
+
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_get_return_timestamps(_handle.DangerousGetHandle(), out var returnTimestamps);
+        OpenVINOGenAIException.ThrowIfError(status, "get return timestamps");
+        return returnTimestamps;
+    }
+
+    /// <summary>
+    /// Gets the maximum initial timestamp index
+    /// </summary>
+    /// <returns>Maximum initial timestamp index</returns>
+    public int GetMaxInitialTimestampIndex()
+    {
+        ThrowIfDisposed();
+
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_get_max_initial_timestamp_index(_handle.DangerousGetHandle(), out var index);
+        OpenVINOGenAIException.ThrowIfError(status, "get max initial timestamp index");
+        return (int)index;
+    }
+
+    /// <summary>
+    /// Switches between greedy decoding and sampling at the given temperature
+    /// </summary>
+    internal void SetSampling(bool doSample, float temperature)
+    {
+        ThrowIfDisposed();
+
+        using var baseConfig = GetBaseConfig();
+        var status = GenAINativeMethods.ov_genai_generation_config_set_do_sample(baseConfig.DangerousGetHandle(), doSample);
+        OpenVINOGenAIException.ThrowIfError(status, "set do_sample");
+
+        if (doSample)
+        {
+            status = GenAINativeMethods.ov_genai_generation_config_set_temperature(baseConfig.DangerousGetHandle(), temperature);
+            OpenVINOGenAIException.ThrowIfError(status, "set temperature");
+        }
+    }
+
+    private static WhisperGenerationConfigSafeHandle CreateDefaultHandle()
+    {
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_create(out var handle);
+        OpenVINOGenAIException.ThrowIfError(status, "create whisper generation config");
+        return new WhisperGenerationConfigSafeHandle(handle, true);
+    }
+
+    private static WhisperGenerationConfigSafeHandle CreateHandleFromJson(string jsonPath)
+    {
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_create_from_json(jsonPath, out var handle);
+        OpenVINOGenAIException.ThrowIfError(status, "create whisper generation config from JSON");
+        return new WhisperGenerationConfigSafeHandle(handle, true);
+    }
+
+    /// <summary>
+    /// Gets a handle to the base generation config that shares state with this configuration
+    /// </summary>
+    private GenerationConfigSafeHandle GetBaseConfig()
+    {
+        var status = GenAINativeMethods.ov_genai_whisper_generation_config_get_generation_config(_handle.DangerousGetHandle(), out var handle);
+        OpenVINOGenAIException.ThrowIfError(status, "get base generation config");
+        return new GenerationConfigSafeHandle(handle, true);
+    }
+
     /// <summary>
     /// Validates the configuration
     /// </summary>
@@ -0,0 +1,111 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Represents the result of spoken language detection
+/// </summary>
+/// <remarks>
+/// The confidences rank the candidates against each other: each is a softmax, over the
+/// candidates, of the mean per-token log-likelihood of a short decode with that language
+/// forced. They are not the model's language-token probabilities, which the C API does not expose.
+/// </remarks>
+public sealed class WhisperLanguageDetectionResult
+{
+    /// <summary>
+    /// Candidate languages used when none are specified: the four best represented in Whisper's training data
+    /// </summary>
+    /// <remarks>
+    /// Each candidate costs a decode of the window, so the list is kept short; pass the languages
+    /// the audio may actually be in to detect others.
+    /// </remarks>
+    public static IReadOnlyList<string> DefaultCandidates { get; } = new[] { "en", "zh", "de", "es" };
+
+    /// <summary>
+    /// Initializes a new instance of the WhisperLanguageDetectionResult class
+    /// </summary>
+    /// <param name="confidences">Relative confidence of each candidate language code</param>
+    public WhisperLanguageDetectionResult(IReadOnlyDictionary<string, float> confidences)
+    {
+        if (confidences == null)
+            throw new ArgumentNullException(nameof(confidences));
+        if (confidences.Count == 0)
+            throw new ArgumentException("At least one language confidence is required", nameof(confidences));
+
+        Confidences = confidences;
+
+        var best = confidences.First();
+        foreach (var pair in confidences)
+        {
+            if (pair.Value > best.Value)
+                best = pair;
+        }
+
+        Language = best.Key;
+        Confidence = best.Value;
+    }
+
+    /// <summary>
+    /// Gets the most likely language code (e.g., "en")
+    /// </summary>
+    public string Language { get; }
+
+    /// <summary>
+    /// Gets the relative confidence of the most likely language, from 0 to 1 across the candidates
+    /// </summary>
+    public float Confidence { get; }
+
+    /// <summary>
+    /// Gets the relative confidence of each candidate language code; the values sum to 1
+    /// </summary>
+    public IReadOnlyDictionary<string, float> Confidences { get; }
+
+    /// <summary>
+    /// Returns a string representation of this result
+    /// </summary>
+    public override string ToString() => $"{Language} (confidence {Confidence:F2})";
+
+    /// <summary>
+    /// Builds a result from per-language mean token log-likelihoods using a softmax
+    /// </summary>
+    internal static WhisperLanguageDetectionResult FromLogLikelihoods(IReadOnlyList<string> languages, IReadOnlyList<float> logLikelihoods)
+    {
+        var max = logLikelihoods.Max();
+        var sum = 0.0;
+        var weights = new double[logLikelihoods.Count];
+        for (int i = 0; i < weights.Length; i++)
+        {
+            weights[i] = float.IsNegativeInfinity(max) ? 0 : Math.Exp(logLikelihoods[i] - max);
+            sum += weights[i];
+        }
+
+        var confidences = new Dictionary<string, float>(languages.Count, StringComparer.OrdinalIgnoreCase);
+        for (int i = 0; i < weights.Length; i++)
+        {
+            // Fall back to a uniform distribution when no candidate produced output
+            confidences[languages[i]] = sum > 0 ? (float)(weights[i] / sum) : 1f / weights.Length;
+        }
+
+        return new WhisperLanguageDetectionResult(confidences);
+    }
+
+    /// <summary>
+    /// Converts a language code or token to its code form (e.g., "&lt;|en|&gt;" to "en")
+    /// </summary>
+    /// <exception cref="ArgumentException">The code is not two or three letters, as Whisper's codes are</exception>
+    internal static string ToLanguageCode(string language)
+    {
+        var code = language.Trim();
+        if (code.StartsWith("<|", StringComparison.Ordinal) && code.EndsWith("|>", StringComparison.Ordinal))
+        {
+            code = code.Substring(2, code.Length - 4);
+        }
+
+        if (code.Length is < 2 or > 3 || !code.All(c => c is (>= 'a' and <= 'z') or (>= 'A' and <= 'Z')))
+            throw new ArgumentException($"Invalid language code: {language}", nameof(language));
+        return code.ToLowerInvariant();
+    }
+
+    /// <summary>
+    /// Converts a language code or token to the token form expected by the model (e.g., "en" to "&lt;|en|&gt;")
+    /// </summary>
+    internal static string ToLanguageToken(string language) => $"<|{ToLanguageCode(language)}|>";
+}
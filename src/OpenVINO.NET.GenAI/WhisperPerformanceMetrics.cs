@@ -0,0 +1,154 @@
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Performance metrics for a Whisper transcription
+/// </summary>
+/// <remarks>
+/// Values are read once from the native performance metrics when the transcription
+/// completes, so this object holds no native resources. The GenAI C API does not split
+/// the front-end from the encoder; both are contained in <see cref="TimeToFirstToken"/>,
+/// and <see cref="FeatureExtractionAndEncodeTime"/> estimates them by removing one
+/// decoder step from it. For audio decoded in several windows, the estimate is the sum
+/// of each window's, while <see cref="TimeToFirstToken"/> is the first window's.
+/// </remarks>
+public sealed class WhisperPerformanceMetrics
+{
+    // Summed over windows by Combine; otherwise derived from this transcription's timings
+    private float? _encodeTime;
+
+    /// <summary>
+    /// Initializes a new instance of the WhisperPerformanceMetrics class
+    /// </summary>
+    /// <param name="audioDuration">Duration of the transcribed audio in seconds</param>
+    /// <param name="generateDuration">End-to-end generate duration in milliseconds</param>
+    /// <param name="inferenceDuration">Model inference duration in milliseconds</param>
+    /// <param name="timeToFirstToken">Mean time to first token in milliseconds</param>
+    /// <param name="timePerOutputToken">Mean time per output token in milliseconds</param>
+    /// <param name="throughput">Decoder throughput in tokens per second</param>
+    /// <param name="numGeneratedTokens">Number of generated tokens</param>
+    public WhisperPerformanceMetrics(
+        float audioDuration,
+        float generateDuration,
+        float inferenceDuration,
+        float timeToFirstToken,
+        float timePerOutputToken,
+        float throughput,
+        int numGeneratedTokens)
+    {
+        AudioDuration = audioDuration;
+        GenerateDuration = generateDuration;
+        InferenceDuration = inferenceDuration;
+        TimeToFirstToken = timeToFirstToken;
+        TimePerOutputToken = timePerOutputToken;
+        Throughput = throughput;
+        NumGeneratedTokens = numGeneratedTokens;
+    }
+
+    /// <summary>
+    /// Gets the duration of the transcribed audio in seconds
+    /// </summary>
+    public float AudioDuration { get; }
+
+    /// <summary>
+    /// Gets the end-to-end generate duration in milliseconds
+    /// </summary>
+    public float GenerateDuration { get; }
+
+    /// <summary>
+    /// Gets the model inference duration in milliseconds
+    /// </summary>
+    public float InferenceDuration { get; }
+
+    /// <summary>
+    /// Gets the mean time to first token in milliseconds (mel front-end, encoder and first decoder step)
+    /// </summary>
+    public float TimeToFirstToken { get; }
+
+    /// <summary>
+    /// Gets the mean decoder time per output token in milliseconds
+    /// </summary>
+    public float TimePerOutputToken { get; }
+
+    /// <summary>
+    /// Gets the decoder throughput in tokens per second
+    /// </summary>
+    public float Throughput { get; }
+
+    /// <summary>
+    /// Gets the number of generated tokens
+    /// </summary>
+    public int NumGeneratedTokens { get; }
+
+    /// <summary>
+    /// Gets the estimated feature extraction and encoder time in milliseconds
+    /// </summary>
+    public float FeatureExtractionAndEncodeTime => _encodeTime ?? Math.Max(0, TimeToFirstToken - TimePerOutputToken);
+
+    /// <summary>
+    /// Gets the estimated decoder time in milliseconds
+    /// </summary>
+    public float DecodeTime => Math.Max(0, GenerateDuration - FeatureExtractionAndEncodeTime);
+
+    /// <summary>
+    /// Gets the real-time factor (processing time divided by audio duration); lower is faster
+    /// </summary>
+    public float RealTimeFactor => AudioDuration > 0 ? GenerateDuration / 1000f / AudioDuration : 0;
+
+    /// <summary>
+    /// Reads a snapshot from native performance metrics
+    /// </summary>
+    /// <param name="metrics">Native performance metrics</param>
+    /// <param name="audioDuration">Duration of the transcribed audio in seconds</param>
+    internal static WhisperPerformanceMetrics FromNative(PerformanceMetrics metrics, float audioDuration)
+    {
+        return new WhisperPerformanceMetrics(
+            audioDuration,
+            metrics.GetGenerateDuration().Mean,
+            metrics.GetInferenceDuration().Mean,
+            metrics.GetTimeToFirstToken().Mean,
+            metrics.GetTimePerOutputToken().Mean,
+            metrics.GetThroughput().Mean,
+            metrics.NumGenerationTokens);
+    }
+
+    /// <summary>
+    /// Combines the metrics of consecutively decoded windows
+    /// </summary>
+    /// <param name="windows">Metrics of each decoded window</param>
+    /// <param name="audioDuration">Duration of the whole audio in seconds</param>
+    internal static WhisperPerformanceMetrics Combine(IReadOnlyList<WhisperPerformanceMetrics> windows, float audioDuration)
+    {
+        float generateDuration = 0, inferenceDuration = 0, encodeTime = 0, decodeTime = 0;
+        var numGeneratedTokens = 0;
+        foreach (var window in windows)
+        {
+            generateDuration += window.GenerateDuration;
+            inferenceDuration += window.InferenceDuration;
+
+            // Every window runs the front-end and encoder once
+            encodeTime += window.FeatureExtractionAndEncodeTime;
+            decodeTime += window.TimePerOutputToken * window.NumGeneratedTokens;
+            numGeneratedTokens += window.NumGeneratedTokens;
+        }
+
+        var timePerOutputToken = numGeneratedTokens > 0 ? decodeTime / numGeneratedTokens : 0;
+        return new WhisperPerformanceMetrics(
+            audioDuration,
+            generateDuration,
+            inferenceDuration,
+            windows.Count > 0 ? windows[0].TimeToFirstToken : 0,
+            timePerOutputToken,
+            timePerOutputToken > 0 ? 1000f / timePerOutputToken : 0,
+            numGeneratedTokens)
+        {
+            _encodeTime = encodeTime
+        };
+    }
+
+    /// <summary>
+    /// Returns a string representation of these metrics
+    /// </summary>
+    public override string ToString() =>
+        $"Audio: {AudioDuration:F2}s, Generate: {GenerateDuration:F1}ms, RTF: {RealTimeFactor:F3}, " +
+        $"Encode: {FeatureExtractionAndEncodeTime:F1}ms, TTFT: {TimeToFirstToken:F1}ms, TPOT: {TimePerOutputToken:F1}ms";
+}
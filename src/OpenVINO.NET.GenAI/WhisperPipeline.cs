@@ -1,7 +1,13 @@
-using System.Runtime.InteropServices;
+using System.Buffers;
+using System.IO.Pipelines;
+using System.Runtime.CompilerServices;
+using System.Text;
+using System.Threading.Channels;
 using Fluid.OpenVINO.GenAI.Exceptions;
+using Fluid.OpenVINO.GenAI.Logging;
 using Fluid.OpenVINO.GenAI.Native;
 using Fluid.OpenVINO.GenAI.SafeHandles;
+using Microsoft.Extensions.Logging;
 
 namespace Fluid.OpenVINO.GenAI;
 
@@ -10,8 +16,20 @@ namespace Fluid.OpenVINO.GenAI;
 /// </summary>
 public sealed class WhisperPipeline : IDisposable
 {
-    private readonly WhisperPipelineSafeHandle _handle;
+    private const int InitialTextBufferSize = 1024;
+
+    // Tokens decoded per candidate language during language detection
+    private const int LanguageDetectionTokens = 4;
+
+    private readonly PipelineGate _gate;
+    private readonly ILogger _logger;
+    private readonly string _modelIdentity;
+    private readonly ReplicaPlacement? _placement;
     private bool _disposed;
+    private TaskScheduler? _scheduler;
+    private InferenceScheduler? _ownedScheduler;
+    // The model identity covers the generation_config.json the default settings come from
+    private WhisperDecodingOptions _defaultOptions = WhisperDecodingOptions.FromSource("model");
 
     /// <summary>
     /// Initializes a new instance of the WhisperPipeline class
@@ -19,6 +37,33 @@ public sealed class WhisperPipeline : IDisposable
     /// <param name="modelPath">Path to the Whisper model directory</param>
     /// <param name="device">Device to run on (e.g., "CPU", "GPU")</param>
     public WhisperPipeline(string modelPath, string device = "CPU")
+        : this(modelPath, device, null)
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the WhisperPipeline class with typed properties
+    /// </summary>
+    /// <remarks>
+    /// The properties apply to both the encoder and the decoder; the GenAI C API does not
+    /// accept separate properties per submodel.
+    /// </remarks>
+    /// <param name="modelPath">Path to the Whisper model directory</param>
+    /// <param name="device">Device to run on (e.g., "CPU", "GPU")</param>
+    /// <param name="properties">Device and compile properties (e.g., cache directory, thread count)</param>
+    public WhisperPipeline(string modelPath, string device, PipelineProperties? properties)
+        : this(modelPath, device, properties, null)
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the WhisperPipeline class placed on a NUMA node and set of cores
+    /// </summary>
+    /// <param name="modelPath">Path to the Whisper model directory</param>
+    /// <param name="device">Device to run on (e.g., "CPU", "GPU")</param>
+    /// <param name="properties">Device and compile properties (e.g., cache directory, thread count)</param>
+    /// <param name="placement">NUMA node and cores for the pipeline, or null to let threads float</param>
+    public WhisperPipeline(string modelPath, string device, PipelineProperties? properties, ReplicaPlacement? placement)
     {
         if (string.IsNullOrEmpty(modelPath))
             throw new ArgumentException("Model path cannot be null or empty", nameof(modelPath));
@@ -28,16 +73,60 @@ public sealed class WhisperPipeline : IDisposable
         // Ensure native libraries are loaded before any P/Invoke calls
         NativeLibraryLoader.EnsureLoaded();
 
-        var status = GenAINativeMethods.ov_genai_whisper_pipeline_create(
-            modelPath,
-            device,
-            0, // No properties for now
-            out var handle);
+        properties = placement?.ApplyTo(properties, device) ?? properties;
+
+        ov_status_e status;
+        IntPtr handle;
+        using var binding = placement?.Bind();
+        if (properties == null || properties.Count == 0)
+        {
+            status = GenAINativeMethods.ov_genai_whisper_pipeline_create(modelPath, device, 0, out handle);
+        }
+        else
+        {
+            var args = properties.ToNativeArgs();
+            status = GenAINativeMethods.ov_genai_whisper_pipeline_create_with_properties(
+                modelPath,
+                device,
+                (nuint)(properties.Count * 2), // key + value per property
+                out handle,
+                args[0],
+                args[1],
+                args[2],
+                args[3],
+                args[4],
+                args[5],
+                args[6],
+                args[7],
+                args[8],
+                args[9],
+                args[10],
+                args[11],
+                args[12],
+                args[13],
+                args[14],
+                args[15]);
+        }
 
         OpenVINOGenAIException.ThrowIfError(status, "create Whisper pipeline");
-        _handle = new WhisperPipelineSafeHandle(handle, true);
+        _gate = new PipelineGate(new WhisperPipelineSafeHandle(handle, true), nameof(WhisperPipeline));
+        _placement = placement;
+
+        _logger = GenAILogging.CreateLogger<WhisperPipeline>();
+        _modelIdentity = ComputeModelIdentity(modelPath, device);
+        Log.PipelineCreated(_logger, nameof(WhisperPipeline), modelPath, device);
     }
 
+    /// <summary>
+    /// Gets or sets the transcription cache, or null to disable caching
+    /// </summary>
+    /// <remarks>
+    /// When set, <see cref="Generate"/> and the APIs built on it (async, file and batch
+    /// transcription) return stored results for audio already transcribed with the same
+    /// settings, and <see cref="GenerateStreamAsync"/> reuses results per 30 second window.
+    /// </remarks>
+    public TranscriptionCache? Cache { get; set; }
+
     /// <summary>
     /// Generates transcription from raw audio data
     /// </summary>
@@ -47,46 +136,29 @@ public sealed class WhisperPipeline : IDisposable
     public IReadOnlyList<WhisperDecodedResult> Generate(float[] audioData, WhisperGenerationConfig? config = null)
     {
         ThrowIfDisposed();
-
-        System.Diagnostics.Debug.WriteLine($"[WhisperPipeline] Generate called. AudioData: {(audioData == null ? "null" : audioData.Length.ToString())} samples, Config: {(config == null ? "null" : "provided")}");
-
         if (audioData == null)
             throw new ArgumentNullException(nameof(audioData));
         if (audioData.Length == 0)
             throw new ArgumentException("Audio data cannot be empty", nameof(audioData));
 
-        var configHandle = config?.Handle ?? IntPtr.Zero;
+        Log.Transcribing(_logger, audioData.Length);
 
-        Console.WriteLine($"[WhisperPipeline] Invoking native generate. Handle: {_handle.DangerousGetHandle()}, ConfigHandle: {configHandle}");
+        var options = config?.Options ?? _defaultOptions;
+        if (TryGetCached(audioData, config, options, "full", out var cacheKey, out var cached))
+            return cached;
 
         try
         {
-            var status = GenAINativeMethods.ov_genai_whisper_pipeline_generate(
-                _handle.DangerousGetHandle(),
-                audioData,
-                (nuint)audioData.Length,
-                configHandle,
-                out var resultsHandle);
-
-            Console.WriteLine($"[WhisperPipeline] Native generate returned status: {status}, ResultsHandle: {resultsHandle}");
-
-            OpenVINOGenAIException.ThrowIfError(status, "generate transcription");
-
-            using var results = new WhisperDecodedResultsSafeHandle(resultsHandle, true);
-
-            Console.WriteLine("[WhisperPipeline] Extracting results from native handle.");
-
-            var extractedResults = ExtractResults(results);
-
-            Console.WriteLine($"[WhisperPipeline] Extracted {extractedResults.Count} results.");
-
+            // Held across every window, so the transcription counts as active between them
+            using var call = _gate.Enter();
+            var extractedResults = GenerateCore(audioData, config);
+            Log.TranscriptionCompleted(_logger, extractedResults.Count);
+            StoreCached(cacheKey, extractedResults);
             return extractedResults;
         }
         catch (Exception ex)
         {
-            // Print the full exception details to the console for better diagnostics
-            Console.Error.WriteLine("Exception occurred during WhisperPipeline.Generate:");
-            Console.Error.WriteLine(ex.ToString());
+            Log.TranscriptionFailed(_logger, ex);
             throw;
         }
     }
@@ -103,8 +175,252 @@ public sealed class WhisperPipeline : IDisposable
         WhisperGenerationConfig? config = null,
         CancellationToken cancellationToken = default)
     {
-        // Run the synchronous generation on a background thread
-        return await Task.Run(() => Generate(audioData, config), cancellationToken);
+        ThrowIfDisposed();
+
+        // Wait for the pipeline, then run the synchronous generation on an inference thread
+        return await _gate.RunAsync(Scheduler, () => Generate(audioData, config), cancellationToken);
+    }
+
+    /// <summary>
+    /// Generates transcription with streaming output
+    /// </summary>
+    /// <remarks>
+    /// The GenAI C API does not accept a streamer for Whisper, so streaming happens at
+    /// window granularity: the audio is split into 30 second windows at the quietest point
+    /// near each boundary, and each window's text is yielded as soon as it is decoded.
+    /// With timestamps enabled every timestamped chunk is yielded; otherwise one chunk
+    /// spanning the window is yielded. Timestamps are relative to the start of the audio.
+    /// </remarks>
+    /// <param name="audioData">Raw audio data as float array (16kHz, mono, normalized to [-1, 1])</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>An async enumerable of transcribed chunks</returns>
+    public async IAsyncEnumerable<WhisperChunk> GenerateStreamAsync(
+        float[] audioData,
+        WhisperGenerationConfig? config = null,
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+        if (audioData == null)
+            throw new ArgumentNullException(nameof(audioData));
+        if (audioData.Length == 0)
+            throw new ArgumentException("Audio data cannot be empty", nameof(audioData));
+
+        var channel = Channel.CreateUnbounded<WhisperChunk>(new UnboundedChannelOptions { SingleReader = true, SingleWriter = true });
+        var writer = channel.Writer;
+        var reader = channel.Reader;
+
+        var options = config?.Options ?? _defaultOptions;
+
+        // Start generation on an inference thread once the pipeline is free; it is held across every window
+        var generationTask = _gate.RunAsync(Scheduler, () =>
+        {
+            WhisperGenerationConfig? fallbackConfig = null;
+            try
+            {
+                foreach (var (offset, length) in AudioWindowing.Split(audioData))
+                {
+                    if (cancellationToken.IsCancellationRequested)
+                        break;
+
+                    var window = audioData.AsSpan(offset, length);
+                    if (!TryGetCached(window, config, options, "window", out var cacheKey, out var results))
+                    {
+                        results = DecodeWindow(window, config, options, ref fallbackConfig);
+                        StoreCached(cacheKey, results);
+                    }
+
+                    if (results.Count == 0)
+                        continue;
+
+                    var windowStart = AudioWindowing.ToSeconds(offset);
+                    var result = results[0];
+                    if (result.HasChunks)
+                    {
+                        foreach (var chunk in result.Chunks!)
+                        {
+                            writer.TryWrite(new WhisperChunk(windowStart + chunk.StartTime, windowStart + chunk.EndTime, chunk.Text));
+                        }
+                    }
+                    else
+                    {
+                        writer.TryWrite(new WhisperChunk(windowStart, AudioWindowing.ToSeconds(offset + length), result.Text));
+                    }
+                }
+            }
+            finally
+            {
+                fallbackConfig?.Dispose();
+            }
+        }, cancellationToken);
+
+        // Also ends the chunks when the transcription never started, e.g. because the pipeline was disposed
+        _ = generationTask.ContinueWith(
+            static (_, state) => ((ChannelWriter<WhisperChunk>)state!).TryComplete(),
+            writer,
+            CancellationToken.None,
+            TaskContinuationOptions.ExecuteSynchronously,
+            TaskScheduler.Default);
+
+        // Yield chunks as they arrive
+        await foreach (var chunk in reader.ReadAllAsync(cancellationToken))
+        {
+            yield return chunk;
+        }
+
+        // Wait for generation to complete and surface any errors
+        await generationTask;
+    }
+
+    /// <summary>
+    /// Transcribes into a pipe, writing each chunk's UTF-8 text into the writer's memory and
+    /// flushing it as soon as its window is decoded
+    /// </summary>
+    /// <remarks>
+    /// Chunks are produced as by <see cref="GenerateStreamAsync"/>. The C API returns Whisper
+    /// text only as strings, so each chunk is encoded once, directly into the pipe. A completed
+    /// reader stops writing. The writer is flushed but not completed.
+    /// </remarks>
+    /// <param name="audioData">Raw audio data as float array (16kHz, mono, normalized to [-1, 1])</param>
+    /// <param name="writer">Pipe to write to, e.g. an HTTP response body</param>
+    /// <param name="format">Framing of the chunks</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>The number of bytes written, including framing</returns>
+    public async Task<long> GenerateToAsync(
+        float[] audioData,
+        PipeWriter writer,
+        StreamFormat format = StreamFormat.Raw,
+        WhisperGenerationConfig? config = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+
+        var frames = new Utf8FrameWriter(writer, format, TimeSpan.Zero);
+        await foreach (var chunk in GenerateStreamAsync(audioData, config, cancellationToken))
+        {
+            frames.WriteChunk(chunk);
+            await frames.FlushAsync(cancellationToken);
+            if (frames.IsReaderCompleted)
+                break;
+        }
+
+        return frames.BytesWritten;
+    }
+
+    /// <summary>
+    /// Transcribes into a stream
+    /// </summary>
+    /// <param name="audioData">Raw audio data as float array (16kHz, mono, normalized to [-1, 1])</param>
+    /// <param name="stream">Stream to write to; it is left open</param>
+    /// <param name="format">Framing of the chunks</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>The number of bytes written, including framing</returns>
+    public async Task<long> GenerateToAsync(
+        float[] audioData,
+        Stream stream,
+        StreamFormat format = StreamFormat.Raw,
+        WhisperGenerationConfig? config = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(stream);
+
+        var writer = PipeWriter.Create(stream, new StreamPipeWriterOptions(leaveOpen: true));
+        try
+        {
+            return await GenerateToAsync(audioData, writer, format, config, cancellationToken);
+        }
+        finally
+        {
+            await writer.CompleteAsync();
+        }
+    }
+
+    /// <summary>
+    /// Transcribes many audio sources, yielding each result as soon as it finishes
+    /// </summary>
+    /// <remarks>
+    /// Audio for upcoming sources is loaded while the current source is transcribed.
+    /// To transcribe on several replicas at once, create a <see cref="PipelinePool{TPipeline}"/>
+    /// and use <see cref="WhisperPipelinePoolExtensions.TranscribeBatchAsync"/>.
+    /// </remarks>
+    /// <param name="sources">Audio sources to transcribe</param>
+    /// <param name="config">Generation configuration (optional)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Per-source results in completion order</returns>
+    public async IAsyncEnumerable<WhisperBatchResult> TranscribeBatchAsync(
+        IEnumerable<AudioSource> sources,
+        WhisperGenerationConfig? config = null,
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        ThrowIfDisposed();
+        if (sources == null)
+            throw new ArgumentNullException(nameof(sources));
+
+        using var pool = new PipelinePool<WhisperPipeline>(new[] { this }, ownsReplicas: false);
+        await foreach (var result in WhisperBatchScheduler.RunAsync(pool, sources, config, cancellationToken))
+        {
+            yield return result;
+        }
+    }
+
+    /// <summary>
+    /// Detects the spoken language without transcribing the whole audio
+    /// </summary>
+    /// <remarks>
+    /// Only the first 30 second window is used. The GenAI C API returns neither the language
+    /// token Whisper detects nor its logits, so each candidate is scored by forcing its language
+    /// token and decoding a few tokens. That costs one feature extraction and encoder pass per
+    /// candidate, so the cost grows linearly with the number of candidates: each one adds about
+    /// the encoder cost of transcribing the window. The default list is short for that reason;
+    /// pass the expected languages instead. A single candidate is returned without decoding.
+    /// </remarks>
+    /// <param name="audio">Raw audio data (16kHz, mono, normalized to [-1, 1])</param>
+    /// <param name="candidates">Candidate language codes (defaults to <see cref="WhisperLanguageDetectionResult.DefaultCandidates"/>)</param>
+    /// <returns>The detected language with each candidate's relative confidence</returns>
+    public WhisperLanguageDetectionResult DetectLanguage(ReadOnlySpan<float> audio, IEnumerable<string>? candidates = null)
+    {
+        ThrowIfDisposed();
+        if (audio.IsEmpty)
+            throw new ArgumentException("Audio data cannot be empty", nameof(audio));
+
+        var languages = (candidates ?? WhisperLanguageDetectionResult.DefaultCandidates)
+            .Select(WhisperLanguageDetectionResult.ToLanguageCode)
+            .Distinct()
+            .ToArray();
+        if (languages.Length == 0)
+            throw new ArgumentException("At least one candidate language is required", nameof(candidates));
+        if (languages.Length == 1)
+            return WhisperLanguageDetectionResult.FromLogLikelihoods(languages, new[] { 0f });
+
+        var window = audio.Slice(0, Math.Min(audio.Length, AudioWindowing.WindowSamples));
+
+        // Held across every candidate, so other calls can't run between them
+        using var call = _gate.Enter();
+
+        // Start from the model's configuration so special token ids are correct
+        using var config = GetGenerationConfig();
+        config.WithTask(WhisperTask.Transcribe).WithTimestamps(false);
+        config.WithMaxTokens(LanguageDetectionTokens);
+
+        var logLikelihoods = new float[languages.Length];
+        for (int i = 0; i < languages.Length; i++)
+        {
+            config.WithLanguage(languages[i]);
+            var results = GenerateCore(window, config);
+            if (results.Count == 0)
+            {
+                logLikelihoods[i] = float.NegativeInfinity;
+                continue;
+            }
+
+            // Score is the sum of the generated tokens' log-probabilities
+            var tokens = results[0].PerformanceMetrics?.NumGeneratedTokens ?? 0;
+            logLikelihoods[i] = results[0].Score / Math.Max(1, tokens);
+        }
+
+        return WhisperLanguageDetectionResult.FromLogLikelihoods(languages, logLikelihoods);
     }
 
     /// <summary>
@@ -149,12 +465,7 @@ public sealed class WhisperPipeline : IDisposable
     {
         ThrowIfDisposed();
 
-        var status = GenAINativeMethods.ov_genai_whisper_pipeline_get_generation_config(
-            _handle.DangerousGetHandle(),
-            out var configHandle);
-
-        OpenVINOGenAIException.ThrowIfError(status, "get generation config");
-        return new WhisperGenerationConfig(new WhisperGenerationConfigSafeHandle(configHandle, true));
+        return new WhisperGenerationConfig(CreateConfigHandle(), _defaultOptions, CreateConfigHandle);
     }
 
     /// <summary>
@@ -167,129 +478,424 @@ public sealed class WhisperPipeline : IDisposable
         if (config == null)
             throw new ArgumentNullException(nameof(config));
 
+        using var call = _gate.Enter();
+        using var configHandle = new HandleReference(config.Handle);
         var status = GenAINativeMethods.ov_genai_whisper_pipeline_set_generation_config(
-            _handle.DangerousGetHandle(),
-            config.Handle);
+            call.Handle,
+            configHandle.Value);
 
         OpenVINOGenAIException.ThrowIfError(status, "set generation config");
+        _defaultOptions = config.Options.Clone();
     }
 
-    private IReadOnlyList<WhisperDecodedResult> ExtractResults(WhisperDecodedResultsSafeHandle results)
+    private WhisperGenerationConfigSafeHandle CreateConfigHandle()
     {
-        var handle = results.DangerousGetHandle();
+        using var call = _gate.Enter();
+        var status = GenAINativeMethods.ov_genai_whisper_pipeline_get_generation_config(
+            call.Handle,
+            out var configHandle);
 
-        // Get number of results
-        var status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_texts_count(handle, out var count);
-        OpenVINOGenAIException.ThrowIfError(status, "get texts count");
+        OpenVINOGenAIException.ThrowIfError(status, "get generation config");
+        return new WhisperGenerationConfigSafeHandle(configHandle, true);
+    }
 
-        var resultList = new List<WhisperDecodedResult>((int)count);
+    /// <summary>
+    /// Looks up audio in the cache; on a miss, returns the key to store the results under
+    /// </summary>
+    /// <param name="scope">Distinguishes whole-audio entries from per-window entries</param>
+    private bool TryGetCached(
+        ReadOnlySpan<float> audio,
+        WhisperGenerationConfig? config,
+        WhisperDecodingOptions options,
+        string scope,
+        out string? key,
+        out IReadOnlyList<WhisperDecodedResult> results)
+    {
+        key = null;
+        results = Array.Empty<WhisperDecodedResult>();
 
-        for (nuint i = 0; i < count; i++)
+        var cache = Cache;
+        if (cache == null)
+            return false;
+
+        var fingerprint = config?.Fingerprint ?? options.Fingerprint;
+        key = TranscriptionCache.ComputeKey(audio, scope + "\n" + fingerprint, _modelIdentity);
+        if (!cache.TryGet(key, out var entry))
+            return false;
+
+        Log.TranscriptionCacheHit(_logger);
+        results = entry.ToResults(options.EstimatedWordTimings);
+        return true;
+    }
+
+    private void StoreCached(string? key, IReadOnlyList<WhisperDecodedResult> results)
+    {
+        if (key != null)
+            Cache?.Set(key, CachedTranscription.FromResults(results));
+    }
+
+    /// <summary>
+    /// Identifies the model files and device so cache entries are not shared across models
+    /// </summary>
+    private static string ComputeModelIdentity(string modelPath, string device)
+    {
+        var directory = new DirectoryInfo(modelPath);
+        var lastWrite = directory.Exists
+            ? directory.EnumerateFiles().Select(f => f.LastWriteTimeUtc.Ticks).DefaultIfEmpty(0).Max()
+            : 0;
+        return $"{directory.FullName}|{device}|{lastWrite}";
+    }
+
+    private IReadOnlyList<WhisperDecodedResult> GenerateCore(ReadOnlySpan<float> audio, WhisperGenerationConfig? config)
+    {
+        var options = config?.Options ?? _defaultOptions;
+        if (!options.RequiresWindowedDecoding)
+            return DecodeOnce(audio, config, options.EstimatedWordTimings);
+
+        return GenerateWindowed(audio, config, options);
+    }
+
+    /// <summary>
+    /// Decodes the audio one 30 second window at a time so the silence gate and
+    /// temperature fallback can be applied, then merges the windows into one result
+    /// </summary>
+    private IReadOnlyList<WhisperDecodedResult> GenerateWindowed(ReadOnlySpan<float> audio, WhisperGenerationConfig? config, WhisperDecodingOptions options)
+    {
+        var windows = AudioWindowing.Split(audio);
+        var text = new StringBuilder();
+        var chunks = new WhisperChunkBuffer(windows.Count);
+        var windowMetrics = new List<WhisperPerformanceMetrics>(windows.Count);
+        var scoreSum = 0f;
+        var decodedWindows = 0;
+
+        WhisperGenerationConfig? fallbackConfig = null;
+        try
         {
-            // Get text size first
-            nuint textSize = 0;
-            status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_text_at(handle, i, IntPtr.Zero, ref textSize);
-            if (status != ov_status_e.OK && status != ov_status_e.OUT_OF_BOUNDS)
+            foreach (var (offset, length) in windows)
             {
-                OpenVINOGenAIException.ThrowIfError(status, "get text size");
+                var results = DecodeWindow(audio.Slice(offset, length), config, options, ref fallbackConfig);
+                if (results.Count == 0)
+                    continue;
+
+                var result = results[0];
+                text.Append(result.Text);
+                scoreSum += result.Score;
+                decodedWindows++;
+
+                if (result.PerformanceMetrics != null)
+                    windowMetrics.Add(result.PerformanceMetrics);
+
+                var windowChunks = result.ChunkBuffer;
+                if (windowChunks != null)
+                {
+                    var windowStart = AudioWindowing.ToSeconds(offset);
+                    for (int i = 0; i < windowChunks.Count; i++)
+                    {
+                        chunks.Add(windowStart + windowChunks.StartTimes[i], windowStart + windowChunks.EndTimes[i], windowChunks.GetUtf8Text(i));
+                    }
+                }
             }
+        }
+        finally
+        {
+            fallbackConfig?.Dispose();
+        }
 
-            // Allocate buffer and get text
-            var textBuffer = Marshal.AllocHGlobal((int)textSize);
-            try
-            {
-                status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_text_at(handle, i, textBuffer, ref textSize);
-                OpenVINOGenAIException.ThrowIfError(status, "get text");
+        var metrics = WhisperPerformanceMetrics.Combine(windowMetrics, AudioWindowing.ToSeconds(audio.Length));
+        return new[]
+        {
+            new WhisperDecodedResult(
+                text.ToString(),
+                decodedWindows > 0 ? scoreSum / decodedWindows : 0,
+                chunks.Count > 0 ? chunks : null,
+                metrics,
+                options.EstimatedWordTimings)
+        };
+    }
 
-                var text = Marshal.PtrToStringAnsi(textBuffer) ?? string.Empty;
+    /// <summary>
+    /// Decodes one window, skipping it when its energy is below the silence threshold and
+    /// decoding it again at higher temperatures when the text is too repetitive
+    /// </summary>
+    /// <returns>The decoded results, or an empty list if the window was skipped</returns>
+    private IReadOnlyList<WhisperDecodedResult> DecodeWindow(
+        ReadOnlySpan<float> window,
+        WhisperGenerationConfig? config,
+        WhisperDecodingOptions options,
+        ref WhisperGenerationConfig? fallbackConfig)
+    {
+        if (options.SilenceThresholdDbfs is float silenceThreshold && AudioWindowing.RmsDbfs(window) < silenceThreshold)
+            return Array.Empty<WhisperDecodedResult>();
 
-                // Get score
-                status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_score_at(handle, i, out var score);
-                OpenVINOGenAIException.ThrowIfError(status, "get score");
+        var results = DecodeOnce(window, config, options.EstimatedWordTimings);
+        if (options.CompressionRatioThreshold is not float threshold || options.TemperatureFallback is not { Length: > 0 } temperatures)
+            return results;
 
-                // Check if chunks are available
-                status = GenAINativeMethods.ov_genai_whisper_decoded_results_has_chunks(handle, out var hasChunks);
-                OpenVINOGenAIException.ThrowIfError(status, "check chunks");
+        if (results.Count == 0 || WhisperDecodingOptions.CompressionRatio(results[0].Text) <= threshold)
+            return results;
 
-                List<WhisperChunk>? chunks = null;
-                if (hasChunks)
-                {
-                    chunks = ExtractChunks(results);
-                }
+        // Fall back to sampling on a copy, so the caller's config and the pipeline's are never changed
+        fallbackConfig ??= config?.Clone() ?? GetGenerationConfig();
+        foreach (var temperature in temperatures)
+        {
+            fallbackConfig.SetSampling(true, temperature);
+            results = DecodeOnce(window, fallbackConfig, options.EstimatedWordTimings);
+            if (results.Count == 0 || WhisperDecodingOptions.CompressionRatio(results[0].Text) <= threshold)
+                break;
+        }
 
-                resultList.Add(new WhisperDecodedResult(text, score, chunks));
-            }
-            finally
-            {
-                Marshal.FreeHGlobal(textBuffer);
-            }
+        return results;
+    }
+
+    private unsafe IReadOnlyList<WhisperDecodedResult> DecodeOnce(ReadOnlySpan<float> audio, WhisperGenerationConfig? config, bool estimateWords)
+    {
+        ov_status_e status;
+        IntPtr resultsHandle;
+        using var call = _gate.Enter();
+        using var configHandle = new HandleReference(config?.Handle);
+        using var binding = _placement?.Bind();
+        fixed (float* samples = audio)
+        {
+            status = GenAINativeMethods.ov_genai_whisper_pipeline_generate_from_pointer(
+                call.Handle,
+                (IntPtr)samples,
+                (nuint)audio.Length,
+                configHandle.Value,
+                out resultsHandle);
         }
 
-        return resultList;
+        OpenVINOGenAIException.ThrowIfError(status, "generate transcription");
+
+        using var results = new WhisperDecodedResultsSafeHandle(resultsHandle, true);
+        var metrics = ExtractPerformanceMetrics(results, audio.Length);
+        return ExtractResults(results, metrics, estimateWords);
+    }
+
+    private static WhisperPerformanceMetrics ExtractPerformanceMetrics(WhisperDecodedResultsSafeHandle results, int sampleCount)
+    {
+        var status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_perf_metrics(
+            results.DangerousGetHandle(),
+            out var metricsHandle);
+        OpenVINOGenAIException.ThrowIfError(status, "get whisper performance metrics");
+
+        using var metrics = new PerformanceMetrics(new PerformanceMetricsSafeHandle(metricsHandle, true));
+        return WhisperPerformanceMetrics.FromNative(metrics, (float)sampleCount / AudioUtils.WhisperSampleRate);
     }
 
-    private List<WhisperChunk> ExtractChunks(WhisperDecodedResultsSafeHandle results)
+    private static IReadOnlyList<WhisperDecodedResult> ExtractResults(
+        WhisperDecodedResultsSafeHandle results,
+        WhisperPerformanceMetrics? metrics,
+        bool estimateWords)
     {
         var handle = results.DangerousGetHandle();
 
+        // Get number of results
+        var status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_texts_count(handle, out var count);
+        OpenVINOGenAIException.ThrowIfError(status, "get texts count");
+
+        // Chunks belong to the results object, not to individual texts, so extract them once
+        status = GenAINativeMethods.ov_genai_whisper_decoded_results_has_chunks(handle, out var hasChunks);
+        OpenVINOGenAIException.ThrowIfError(status, "check chunks");
+
+        // One scratch buffer is reused for every string copied out of native memory
+        var scratch = ArrayPool<byte>.Shared.Rent(InitialTextBufferSize);
+        try
+        {
+            var chunkBuffer = hasChunks ? ExtractChunks(handle, ref scratch) : null;
+
+            var resultList = new WhisperDecodedResult[(int)count];
+            for (nuint i = 0; i < count; i++)
+            {
+                var textLength = ReadResultText(handle, i, ref scratch);
+                var text = Encoding.UTF8.GetString(scratch, 0, textLength);
+
+                status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_score_at(handle, i, out var score);
+                OpenVINOGenAIException.ThrowIfError(status, "get score");
+
+                resultList[(int)i] = new WhisperDecodedResult(text, score, chunkBuffer, metrics, estimateWords);
+            }
+
+            return resultList;
+        }
+        finally
+        {
+            ArrayPool<byte>.Shared.Return(scratch);
+        }
+    }
+
+    private static WhisperChunkBuffer ExtractChunks(IntPtr handle, ref byte[] scratch)
+    {
         // Get number of chunks
         var status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_chunks_count(handle, out var count);
         OpenVINOGenAIException.ThrowIfError(status, "get chunks count");
 
-        var chunks = new List<WhisperChunk>((int)count);
+        var chunks = new WhisperChunkBuffer((int)count);
 
         for (nuint i = 0; i < count; i++)
         {
-            // Get chunk
-            status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_chunk_at(handle, i, out var chunkHandle);
+            status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_chunk_at(handle, i, out var chunkPtr);
             OpenVINOGenAIException.ThrowIfError(status, "get chunk");
 
-            using var chunk = new WhisperDecodedResultChunkSafeHandle(chunkHandle, true);
-            var chunkPtr = chunk.DangerousGetHandle();
+            try
+            {
+                status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_start_ts(chunkPtr, out var startTime);
+                OpenVINOGenAIException.ThrowIfError(status, "get start timestamp");
 
-            // Get timestamps
-            status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_start_ts(chunkPtr, out var startTime);
-            OpenVINOGenAIException.ThrowIfError(status, "get start timestamp");
+                status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_end_ts(chunkPtr, out var endTime);
+                OpenVINOGenAIException.ThrowIfError(status, "get end timestamp");
+
+                var textLength = ReadChunkText(chunkPtr, ref scratch);
+                chunks.Add(startTime, endTime, scratch.AsSpan(0, textLength));
+            }
+            finally
+            {
+                GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_free(chunkPtr);
+            }
+        }
 
-            status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_end_ts(chunkPtr, out var endTime);
-            OpenVINOGenAIException.ThrowIfError(status, "get end timestamp");
+        return chunks;
+    }
 
-            // Get text size first
-            nuint textSize = 0;
-            status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_text(chunkPtr, IntPtr.Zero, ref textSize);
-            if (status != ov_status_e.OK && status != ov_status_e.OUT_OF_BOUNDS)
+    /// <summary>
+    /// Copies the result text at <paramref name="index"/> into <paramref name="scratch"/>,
+    /// growing it only when the text does not fit
+    /// </summary>
+    /// <returns>Text length in bytes, excluding the null terminator</returns>
+    private static unsafe int ReadResultText(IntPtr handle, nuint index, ref byte[] scratch)
+    {
+        while (true)
+        {
+            var textSize = (nuint)scratch.Length;
+            ov_status_e status;
+            fixed (byte* buffer = scratch)
             {
-                OpenVINOGenAIException.ThrowIfError(status, "get chunk text size");
+                status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_text_at(handle, index, (IntPtr)buffer, ref textSize);
             }
 
-            // Allocate buffer and get text
-            var textBuffer = Marshal.AllocHGlobal((int)textSize);
-            try
+            if (status == ov_status_e.OK)
+                return TerminatedLength(scratch, textSize);
+
+            if (status != ov_status_e.OUT_OF_BOUNDS)
+                OpenVINOGenAIException.ThrowIfError(status, "get text");
+
+            // Buffer too small: query the required size and retry
+            textSize = 0;
+            status = GenAINativeMethods.ov_genai_whisper_decoded_results_get_text_at(handle, index, IntPtr.Zero, ref textSize);
+            OpenVINOGenAIException.ThrowIfError(status, "get text size");
+            GrowScratch(ref scratch, textSize);
+        }
+    }
+
+    /// <summary>
+    /// Copies the chunk text into <paramref name="scratch"/>, growing it only when the text does not fit
+    /// </summary>
+    /// <returns>Text length in bytes, excluding the null terminator</returns>
+    private static unsafe int ReadChunkText(IntPtr chunk, ref byte[] scratch)
+    {
+        while (true)
+        {
+            var textSize = (nuint)scratch.Length;
+            ov_status_e status;
+            fixed (byte* buffer = scratch)
             {
-                status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_text(chunkPtr, textBuffer, ref textSize);
+                status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_text(chunk, (IntPtr)buffer, ref textSize);
+            }
+
+            if (status == ov_status_e.OK)
+                return TerminatedLength(scratch, textSize);
+
+            if (status != ov_status_e.OUT_OF_BOUNDS)
                 OpenVINOGenAIException.ThrowIfError(status, "get chunk text");
 
-                var text = Marshal.PtrToStringAnsi(textBuffer) ?? string.Empty;
-                chunks.Add(new WhisperChunk(startTime, endTime, text));
+            textSize = 0;
+            status = GenAINativeMethods.ov_genai_whisper_decoded_result_chunk_get_text(chunk, IntPtr.Zero, ref textSize);
+            OpenVINOGenAIException.ThrowIfError(status, "get chunk text size");
+            GrowScratch(ref scratch, textSize);
+        }
+    }
+
+    private static int TerminatedLength(byte[] buffer, nuint textSize)
+    {
+        var length = Math.Min((int)textSize, buffer.Length);
+        var terminator = Array.IndexOf(buffer, (byte)0, 0, length);
+        return terminator >= 0 ? terminator : length;
+    }
+
+    private static void GrowScratch(ref byte[] scratch, nuint requiredSize)
+    {
+        var newSize = Math.Max((int)requiredSize, scratch.Length * 2);
+        ArrayPool<byte>.Shared.Return(scratch);
+        scratch = ArrayPool<byte>.Shared.Rent(newSize);
+    }
+
+    /// <summary>
+    /// Gets or sets the scheduler that runs the blocking native calls of the async APIs
+    /// </summary>
+    /// <remarks>
+    /// Defaults to a dedicated thread owned by the pipeline, started on first use. Assign a shared
+    /// <see cref="InferenceScheduler"/> to bound inference threads across pipelines, or
+    /// <see cref="TaskScheduler.Default"/> to use the thread pool.
+    /// </remarks>
+    /// <exception cref="ObjectDisposedException">Read after the pipeline was disposed</exception>
+    public TaskScheduler Scheduler
+    {
+        get
+        {
+            ThrowIfDisposed();
+            var scheduler = InferenceScheduler.GetOrCreate(ref _scheduler, "Whisper inference", out var created);
+            if (created != null)
+            {
+                // Dispose may have run while the scheduler was created; it must not outlive the pipeline
+                Interlocked.Exchange(ref _ownedScheduler, created);
+                if (Volatile.Read(ref _disposed))
+                {
+                    created.Dispose();
+                    ThrowIfDisposed();
+                }
             }
-            finally
+            return scheduler;
+        }
+        set
+        {
+            ArgumentNullException.ThrowIfNull(value);
+            var previous = Interlocked.Exchange(ref _scheduler, value);
+            if (previous != value && previous is InferenceScheduler owned && owned == _ownedScheduler)
             {
-                Marshal.FreeHGlobal(textBuffer);
+                // Calls already queued still run
+                _ownedScheduler = null;
+                owned.Dispose();
             }
         }
-
-        return chunks;
     }
 
+    /// <summary>
+    /// Gets the number of transcriptions and other native calls running or waiting for the pipeline
+    /// </summary>
+    /// <remarks>
+    /// A transcription holds the pipeline from its first window to its last, so it is counted
+    /// between windows too.
+    /// </remarks>
+    public int ActiveGenerations => _gate.ActiveCalls;
+
     /// <summary>
     /// Disposes the native resources
     /// </summary>
+    /// <remarks>
+    /// Transcriptions in flight fail with <see cref="ObjectDisposedException"/> before their next
+    /// window. Dispose waits up to 30 seconds for the window being decoded; the native pipeline
+    /// is freed once the last running call has returned.
+    /// </remarks>
     public void Dispose()
     {
         if (!_disposed)
         {
-            _handle?.Dispose();
             _disposed = true;
+            var running = _gate?.Close() ?? 0;
+            if (running > 0)
+            {
+                Log.PipelineDisposedWhileBusy(_logger, nameof(WhisperPipeline), running);
+            }
+            Interlocked.Exchange(ref _ownedScheduler, null)?.Dispose();
         }
     }
 
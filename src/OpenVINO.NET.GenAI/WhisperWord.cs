@@ -0,0 +1,219 @@
+using System.Collections;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Represents a single word with estimated timings
+/// </summary>
+/// <remarks>
+/// The times are interpolated inside the word's timestamped segment, not aligned by the model.
+/// </remarks>
+public readonly struct WhisperWord
+{
+    /// <summary>
+    /// Initializes a new instance of the WhisperWord struct
+    /// </summary>
+    /// <param name="startTime">Estimated start time in seconds</param>
+    /// <param name="endTime">Estimated end time in seconds</param>
+    /// <param name="text">Word text</param>
+    public WhisperWord(float startTime, float endTime, ReadOnlyMemory<char> text)
+    {
+        StartTime = startTime;
+        EndTime = endTime;
+        Text = text;
+    }
+
+    /// <summary>
+    /// Gets the estimated start time in seconds
+    /// </summary>
+    public float StartTime { get; }
+
+    /// <summary>
+    /// Gets the estimated end time in seconds
+    /// </summary>
+    public float EndTime { get; }
+
+    /// <summary>
+    /// Gets the word text as a slice of the transcript, without allocating a string
+    /// </summary>
+    public ReadOnlyMemory<char> Text { get; }
+
+    /// <summary>
+    /// Gets the duration of this word in seconds
+    /// </summary>
+    public float Duration => EndTime - StartTime;
+
+    /// <summary>
+    /// Returns a string representation of this word
+    /// </summary>
+    public override string ToString() => $"[{StartTime:F2}s - {EndTime:F2}s]: {Text}";
+}
+
+/// <summary>
+/// Compact collection of words with estimated timings, backed by flat arrays and one shared transcript string
+/// </summary>
+public sealed class WhisperWordCollection : IReadOnlyList<WhisperWord>
+{
+    private readonly string _text;
+    private readonly float[] _startTimes;
+    private readonly float[] _endTimes;
+    private readonly int[] _textOffsets;
+    private readonly int[] _textLengths;
+    private readonly int _count;
+
+    private WhisperWordCollection(string text, float[] startTimes, float[] endTimes, int[] textOffsets, int[] textLengths, int count)
+    {
+        _text = text;
+        _startTimes = startTimes;
+        _endTimes = endTimes;
+        _textOffsets = textOffsets;
+        _textLengths = textLengths;
+        _count = count;
+    }
+
+    /// <summary>
+    /// Gets the number of words
+    /// </summary>
+    public int Count => _count;
+
+    /// <summary>
+    /// Gets the word at the specified index
+    /// </summary>
+    public WhisperWord this[int index]
+    {
+        get
+        {
+            if ((uint)index >= (uint)_count)
+                throw new ArgumentOutOfRangeException(nameof(index));
+
+            return new WhisperWord(
+                _startTimes[index],
+                _endTimes[index],
+                _text.AsMemory(_textOffsets[index], _textLengths[index]));
+        }
+    }
+
+    /// <summary>
+    /// Gets the estimated start times of all words in seconds
+    /// </summary>
+    public ReadOnlySpan<float> StartTimes => _startTimes.AsSpan(0, _count);
+
+    /// <summary>
+    /// Gets the estimated end times of all words in seconds
+    /// </summary>
+    public ReadOnlySpan<float> EndTimes => _endTimes.AsSpan(0, _count);
+
+    /// <summary>
+    /// Returns an enumerator that iterates through the words
+    /// </summary>
+    public IEnumerator<WhisperWord> GetEnumerator()
+    {
+        for (int i = 0; i < _count; i++)
+        {
+            yield return this[i];
+        }
+    }
+
+    IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+    /// <summary>
+    /// Estimates word timings from timestamped segments
+    /// </summary>
+    /// <remarks>
+    /// Each segment's time span is distributed across its words in proportion to their
+    /// length in letters and digits, so word boundaries always stay inside the segment
+    /// boundaries reported by the model. Pauses and speaking rate inside a segment are not
+    /// reflected.
+    /// </remarks>
+    /// <param name="segments">Segments as (start, end, text) triples</param>
+    /// <returns>The word collection</returns>
+    public static WhisperWordCollection EstimateFromSegments(IEnumerable<(float StartTime, float EndTime, string Text)> segments)
+    {
+        if (segments == null)
+            throw new ArgumentNullException(nameof(segments));
+
+        var builder = new System.Text.StringBuilder();
+        var capacity = 16;
+        var startTimes = new float[capacity];
+        var endTimes = new float[capacity];
+        var offsets = new int[capacity];
+        var lengths = new int[capacity];
+        var count = 0;
+
+        foreach (var (segmentStart, segmentEnd, segmentText) in segments)
+        {
+            if (string.IsNullOrEmpty(segmentText))
+                continue;
+
+            var baseOffset = builder.Length;
+            builder.Append(segmentText);
+            var span = segmentText.AsSpan();
+
+            // First pass: total weight of the segment
+            var totalWeight = 0;
+            var i = 0;
+            while (NextWord(span, ref i, out var start, out var length))
+            {
+                totalWeight += Weight(span.Slice(start, length));
+            }
+            if (totalWeight == 0)
+                continue;
+
+            // Second pass: assign proportional spans
+            var duration = Math.Max(0, segmentEnd - segmentStart);
+            var consumed = 0;
+            i = 0;
+            while (NextWord(span, ref i, out var wordStart, out var wordLength))
+            {
+                if (count == capacity)
+                {
+                    capacity *= 2;
+                    Array.Resize(ref startTimes, capacity);
+                    Array.Resize(ref endTimes, capacity);
+                    Array.Resize(ref offsets, capacity);
+                    Array.Resize(ref lengths, capacity);
+                }
+
+                var weight = Weight(span.Slice(wordStart, wordLength));
+                startTimes[count] = segmentStart + duration * consumed / totalWeight;
+                consumed += weight;
+                endTimes[count] = segmentStart + duration * consumed / totalWeight;
+                offsets[count] = baseOffset + wordStart;
+                lengths[count] = wordLength;
+                count++;
+            }
+        }
+
+        return new WhisperWordCollection(builder.ToString(), startTimes, endTimes, offsets, lengths, count);
+    }
+
+    internal static WhisperWordCollection FromChunks(WhisperChunkBuffer chunks)
+    {
+        var segments = new (float, float, string)[chunks.Count];
+        for (int i = 0; i < chunks.Count; i++)
+        {
+            segments[i] = (chunks.StartTimes[i], chunks.EndTimes[i], chunks.GetText(i));
+        }
+        return EstimateFromSegments(segments);
+    }
+
+    private static bool NextWord(ReadOnlySpan<char> text, ref int position, out int start, out int length)
+    {
+        while (position < text.Length && char.IsWhiteSpace(text[position])) position++;
+        start = position;
+        while (position < text.Length && !char.IsWhiteSpace(text[position])) position++;
+        length = position - start;
+        return length > 0;
+    }
+
+    private static int Weight(ReadOnlySpan<char> word)
+    {
+        var weight = 1;
+        foreach (var c in word)
+        {
+            if (char.IsLetterOrDigit(c))
+                weight++;
+        }
+        return weight;
+    }
+}
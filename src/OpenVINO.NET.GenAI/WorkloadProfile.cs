@@ -0,0 +1,100 @@
+using System.Text;
+
+namespace Fluid.OpenVINO.GenAI;
+
+/// <summary>
+/// Describes the requests a pipeline is expected to serve, used to rank devices by benchmark
+/// </summary>
+/// <remarks>
+/// Candidates are ranked by the estimated latency of one typical request:
+/// TTFT + (OutputTokens - 1) × TPOT. Long prompts with short answers favour fast prefill,
+/// long answers favour fast decoding.
+/// </remarks>
+public sealed class WorkloadProfile
+{
+    private const int MaxBenchmarkTokens = 32;
+    private const string PromptSentence = "The quick brown fox jumps over the lazy dog near the quiet river bank. ";
+
+    /// <summary>
+    /// Initializes a new instance of the WorkloadProfile class
+    /// </summary>
+    /// <param name="name">Profile name; part of the key under which selections are stored</param>
+    /// <param name="promptWords">Approximate prompt length in words</param>
+    /// <param name="outputTokens">Typical number of generated tokens</param>
+    public WorkloadProfile(string name, int promptWords, int outputTokens)
+    {
+        if (string.IsNullOrWhiteSpace(name))
+            throw new ArgumentException("Profile name cannot be null or empty", nameof(name));
+        if (promptWords <= 0)
+            throw new ArgumentOutOfRangeException(nameof(promptWords), "Prompt length must be positive");
+        if (outputTokens <= 0)
+            throw new ArgumentOutOfRangeException(nameof(outputTokens), "Output length must be positive");
+
+        Name = name;
+        PromptWords = promptWords;
+        OutputTokens = outputTokens;
+    }
+
+    /// <summary>
+    /// Interactive chat: short prompts and medium-length answers
+    /// </summary>
+    public static WorkloadProfile Chat { get; } = new("chat", 64, 128);
+
+    /// <summary>
+    /// Retrieval-augmented generation and summarization: long prompts and short answers
+    /// </summary>
+    public static WorkloadProfile LongPrompt { get; } = new("long-prompt", 1024, 64);
+
+    /// <summary>
+    /// Classification and extraction: short prompts and very short answers
+    /// </summary>
+    public static WorkloadProfile ShortAnswer { get; } = new("short-answer", 32, 8);
+
+    /// <summary>
+    /// Gets the profile name
+    /// </summary>
+    public string Name { get; }
+
+    /// <summary>
+    /// Gets the approximate prompt length in words
+    /// </summary>
+    public int PromptWords { get; }
+
+    /// <summary>
+    /// Gets the typical number of generated tokens
+    /// </summary>
+    public int OutputTokens { get; }
+
+    /// <summary>
+    /// Gets the number of tokens generated per benchmark run; TPOT settles after a few tokens
+    /// </summary>
+    internal int BenchmarkTokens => Math.Min(OutputTokens, MaxBenchmarkTokens);
+
+    /// <summary>
+    /// Estimates the latency of one request of this profile
+    /// </summary>
+    /// <param name="timeToFirstTokenMs">Time to first token in milliseconds</param>
+    /// <param name="timePerOutputTokenMs">Time per output token in milliseconds</param>
+    /// <returns>Estimated request latency in milliseconds</returns>
+    public double EstimateLatency(double timeToFirstTokenMs, double timePerOutputTokenMs)
+        => timeToFirstTokenMs + (OutputTokens - 1) * timePerOutputTokenMs;
+
+    /// <summary>
+    /// Builds a synthetic prompt of about <see cref="PromptWords"/> words
+    /// </summary>
+    internal string CreatePrompt()
+    {
+        var builder = new StringBuilder();
+        var words = 0;
+        while (words < PromptWords)
+        {
+            builder.Append(PromptSentence);
+            words += 14;
+        }
+
+        return builder.Append("Summarize the text above.").ToString();
+    }
+
+    /// <inheritdoc/>
+    public override string ToString() => $"{Name} ({PromptWords} words in, {OutputTokens} tokens out)";
+}
@@ -0,0 +1,82 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for AudioWindowing
+/// </summary>
+public class AudioWindowingTests
+{
+    private const int SampleRate = AudioUtils.WhisperSampleRate;
+    private const int FrameSamples = SampleRate / 50;
+
+    private static float[] CreateNoise(int length, int seed = 1)
+    {
+        var random = new Random(seed);
+        var audio = new float[length];
+        for (int i = 0; i < audio.Length; i++)
+        {
+            audio[i] = (float)(random.NextDouble() - 0.5);
+        }
+        return audio;
+    }
+
+    [Theory]
+    [InlineData(1, AudioWindowing.WindowSamples)]
+    [InlineData(AudioWindowing.WindowSamples, AudioWindowing.WindowSamples)]
+    [InlineData(AudioWindowing.WindowSamples + 1, AudioWindowing.WindowSamples)]
+    [InlineData(5 * AudioWindowing.WindowSamples / 2, AudioWindowing.WindowSamples)]
+    [InlineData(10 * SampleRate + 123, SampleRate)]
+    public void AudioWindowing_Split_CoversEverySampleOnceWithinTheMaximum(int length, int maxWindowSamples)
+    {
+        // Arrange
+        var audio = CreateNoise(length);
+
+        // Act
+        var windows = AudioWindowing.Split(audio, maxWindowSamples);
+
+        // Assert
+        var next = 0;
+        foreach (var (offset, windowLength) in windows)
+        {
+            Assert.Equal(next, offset);
+            Assert.InRange(windowLength, 1, maxWindowSamples);
+            next = offset + windowLength;
+        }
+        Assert.Equal(length, next);
+    }
+
+    [Fact]
+    public void AudioWindowing_Split_CutsAtTheQuietestFrameOfTheLastTwoSeconds()
+    {
+        // Arrange
+        var audio = CreateNoise(5 * AudioWindowing.WindowSamples / 2);
+
+        // A silent frame 1.2 s before the boundary, and a silent stretch too early to be considered
+        var silentFrame = AudioWindowing.WindowSamples - 2 * SampleRate + 40 * FrameSamples;
+        Array.Clear(audio, silentFrame, FrameSamples);
+        Array.Clear(audio, 10 * SampleRate, SampleRate);
+
+        // Act
+        var windows = AudioWindowing.Split(audio);
+
+        // Assert
+        Assert.Equal(silentFrame + FrameSamples / 2, windows[0].Length);
+        Assert.Equal(windows[0].Length, windows[1].Offset);
+    }
+
+    [Fact]
+    public void AudioWindowing_Split_ShortInput_IsASingleWindow()
+    {
+        // Arrange
+        var audio = CreateNoise(3 * SampleRate);
+
+        // Act
+        var windows = AudioWindowing.Split(audio);
+
+        // Assert
+        Assert.Single(windows);
+        Assert.Equal((0, audio.Length), windows[0]);
+    }
+}
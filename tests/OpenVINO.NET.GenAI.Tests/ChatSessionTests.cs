@@ -0,0 +1,69 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for ChatSession compaction and CacheEvictionConfig
+/// </summary>
+public class ChatSessionTests
+{
+    private static List<ChatTurn> CreateTurns(params int[] tokens)
+        => tokens.Select((count, i) => new ChatTurn($"user {i}", $"assistant {i}", count)).ToList();
+
+    [Fact]
+    public void ChatSession_SelectKeptTurns_KeepsStartAndRecentTurnsWithinBudgets()
+    {
+        // Arrange
+        var turns = CreateTurns(20, 20, 30, 30, 15, 25);
+        var config = new CacheEvictionConfig(startSize: 45, recentSize: 40, maxCacheSize: 200);
+
+        // Act
+        var kept = ChatSession.SelectKeptTurns(turns, config);
+
+        // Assert
+        Assert.Equal(new[] { "user 0", "user 1", "user 4", "user 5" }, kept.Select(t => t.User).ToArray());
+    }
+
+    [Fact]
+    public void ChatSession_SelectKeptTurns_DoesNotKeepATurnTwice()
+    {
+        // Arrange
+        var turns = CreateTurns(10, 10, 10);
+        var config = new CacheEvictionConfig(startSize: 25, recentSize: 25, maxCacheSize: 100);
+
+        // Act
+        var kept = ChatSession.SelectKeptTurns(turns, config);
+
+        // Assert
+        Assert.Equal(new[] { "user 0", "user 1", "user 2" }, kept.Select(t => t.User).ToArray());
+    }
+
+    [Fact]
+    public void ChatSession_SelectKeptTurns_DropsTurnsLargerThanBothBudgets()
+    {
+        // Arrange
+        var turns = CreateTurns(50, 10);
+        var config = new CacheEvictionConfig(startSize: 20, recentSize: 20, maxCacheSize: 100);
+
+        // Act
+        var kept = ChatSession.SelectKeptTurns(turns, config);
+
+        // Assert
+        Assert.Equal(new[] { "user 1" }, kept.Select(t => t.User).ToArray());
+    }
+
+    [Fact]
+    public void CacheEvictionConfig_InvalidSizes_Throws()
+    {
+        // Act & Assert
+        Assert.Throws<ArgumentOutOfRangeException>(() => new CacheEvictionConfig(-1, 10, 100));
+        Assert.Throws<ArgumentOutOfRangeException>(() => new CacheEvictionConfig(10, 10, 0));
+        Assert.Throws<ArgumentException>(() => new CacheEvictionConfig(60, 40, 100));
+
+        var config = new CacheEvictionConfig(32, 256, 1024);
+        Assert.Equal(32, config.StartSize);
+        Assert.Equal(256, config.RecentSize);
+        Assert.Equal(1024, config.MaxCacheSize);
+    }
+}
@@ -0,0 +1,129 @@
+using Fluid.OpenVINO.GenAI;
+using Fluid.OpenVINO.GenAI.Exceptions;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for DeviceSelector candidate selection and workload profiles
+/// </summary>
+public class DeviceSelectorTests
+{
+    private static DeviceBenchmarkResult CreateResult(string device, double ttft, double tpot, int generatedTokens)
+        => new(new DeviceCandidate(device, null), ttft, tpot, WorkloadProfile.Chat.EstimateLatency(ttft, tpot), generatedTokens, TimeSpan.Zero, null);
+
+    private static DeviceBenchmarkResult CreateFailure(string device, Exception error)
+        => new(new DeviceCandidate(device, null), double.NaN, double.NaN, double.NaN, 0, TimeSpan.Zero, error);
+
+    [Fact]
+    public void GetCandidates_CpuWithBF16_TriesBothPrecisions()
+    {
+        // Arrange
+        var devices = new[] { new DeviceInfo("CPU", "Test CPU", new[] { "FP32", "BF16", "INT8" }) };
+
+        // Act
+        var candidates = DeviceSelector.GetCandidates(devices);
+
+        // Assert
+        Assert.Equal(new[] { "CPU (F32)", "CPU (BF16)" }, candidates.Select(c => c.ToString()));
+    }
+
+    [Fact]
+    public void GetCandidates_CpuAndGpu_AddsAutoAndHetero()
+    {
+        // Arrange
+        var devices = new[]
+        {
+            new DeviceInfo("CPU", "Test CPU", new[] { "FP32" }),
+            new DeviceInfo("GPU.0", "Test GPU", new[] { "FP32", "FP16" })
+        };
+
+        // Act
+        var candidates = DeviceSelector.GetCandidates(devices);
+
+        // Assert
+        Assert.Equal(
+            new[] { "CPU (F32)", "GPU.0", "AUTO", "HETERO:GPU.0,CPU" },
+            candidates.Select(c => c.ToString()));
+        Assert.Null(candidates[1].CreateProperties()["INFERENCE_PRECISION_HINT"]);
+        Assert.Equal("f32", candidates[0].CreateProperties()["INFERENCE_PRECISION_HINT"]);
+    }
+
+    [Fact]
+    public void SelectBest_NoCandidates_ThrowsWithoutInnerException()
+    {
+        // Act & Assert
+        var exception = Assert.Throws<OpenVINOGenAIException>(() => DeviceSelector.SelectBest(Array.Empty<DeviceBenchmarkResult>(), "model"));
+        Assert.Null(exception.InnerException);
+        Assert.Contains("No device candidates", exception.Message);
+    }
+
+    [Fact]
+    public void SelectBest_AllCandidatesFailed_ThrowsWithTheFirstError()
+    {
+        // Arrange
+        var error = new InvalidOperationException("compile failed");
+        var results = new[] { CreateFailure("GPU.0", error), CreateFailure("CPU", new ArgumentException("bad property")) };
+
+        // Act & Assert
+        var exception = Assert.Throws<OpenVINOGenAIException>(() => DeviceSelector.SelectBest(results, "model"));
+        Assert.Same(error, exception.InnerException);
+    }
+
+    [Fact]
+    public void SelectBest_SingleTokenRun_DoesNotWinOnItsZeroTimePerOutputToken()
+    {
+        // Arrange
+        var results = new[]
+        {
+            CreateFailure("NPU", new InvalidOperationException("unsupported")),
+            CreateResult("GPU.0", ttft: 50, tpot: 0, generatedTokens: 1),
+            CreateResult("CPU", ttft: 200, tpot: 30, generatedTokens: 16)
+        };
+
+        // Act
+        var best = DeviceSelector.SelectBest(results, "model");
+
+        // Assert
+        Assert.Equal("CPU", best.Candidate.Device);
+    }
+
+    [Fact]
+    public void SelectBest_OnlySingleTokenRuns_RanksOnTimeToFirstToken()
+    {
+        // Arrange
+        var results = new[]
+        {
+            CreateResult("CPU", ttft: 200, tpot: 0, generatedTokens: 1),
+            CreateResult("GPU.0", ttft: 50, tpot: 0, generatedTokens: 1)
+        };
+
+        // Act
+        var best = DeviceSelector.SelectBest(results, "model");
+
+        // Assert
+        Assert.Equal("GPU.0", best.Candidate.Device);
+    }
+
+    [Fact]
+    public void WorkloadProfile_EstimateLatency_WeighsDecodingByOutputLength()
+    {
+        // Arrange
+        var fastPrefill = (Ttft: 50.0, Tpot: 40.0);
+        var fastDecode = (Ttft: 400.0, Tpot: 20.0);
+
+        // Act & Assert
+        Assert.True(WorkloadProfile.ShortAnswer.EstimateLatency(fastPrefill.Ttft, fastPrefill.Tpot)
+            < WorkloadProfile.ShortAnswer.EstimateLatency(fastDecode.Ttft, fastDecode.Tpot));
+        Assert.True(WorkloadProfile.Chat.EstimateLatency(fastDecode.Ttft, fastDecode.Tpot)
+            < WorkloadProfile.Chat.EstimateLatency(fastPrefill.Ttft, fastPrefill.Tpot));
+    }
+
+    [Fact]
+    public void WorkloadProfile_InvalidLength_ThrowsArgumentOutOfRangeException()
+    {
+        // Act & Assert
+        Assert.Throws<ArgumentOutOfRangeException>(() => new WorkloadProfile("bad", 0, 10));
+        Assert.Throws<ArgumentOutOfRangeException>(() => new WorkloadProfile("bad", 10, 0));
+    }
+}
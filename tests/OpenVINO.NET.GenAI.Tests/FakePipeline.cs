@@ -0,0 +1,13 @@
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Pipeline stand-in for tests of pools, hosting and scheduling that need no model
+/// </summary>
+internal sealed class FakePipeline : IDisposable
+{
+    public bool IsWarm { get; set; }
+
+    public bool IsDisposed { get; private set; }
+
+    public void Dispose() => IsDisposed = true;
+}
@@ -0,0 +1,116 @@
+using Fluid.OpenVINO.GenAI;
+using Fluid.OpenVINO.GenAI.Hosting;
+using Microsoft.Extensions.DependencyInjection;
+using Microsoft.Extensions.Diagnostics.HealthChecks;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Abstractions;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for the dependency injection integration
+/// </summary>
+public class GenAIHostingTests
+{
+    private static ServiceProvider BuildProvider(Action<OpenVINOGenAIOptions> configure)
+    {
+        var services = new ServiceCollection();
+        services.AddSingleton<ILoggerFactory>(NullLoggerFactory.Instance);
+        services.AddOpenVINOGenAI(options =>
+        {
+            options.UseHostLogging = false;
+            configure(options);
+        });
+        return services.BuildServiceProvider();
+    }
+
+    private static Task<HealthCheckResult> CheckHealthAsync(IServiceProvider provider) =>
+        new GenAIHealthCheck(provider.GetRequiredService<GenAIPipelineRegistry>()).CheckHealthAsync(new HealthCheckContext());
+
+    [Fact]
+    public async Task AddOpenVINOGenAI_LoadAll_CreatesAndWarmsEveryReplica()
+    {
+        // Arrange
+        var created = 0;
+        using var provider = BuildProvider(o => o.AddPipeline(
+            "fake",
+            () => { Interlocked.Increment(ref created); return new FakePipeline(); },
+            replicas: 3,
+            warmup: p => p.IsWarm = true));
+        var registry = provider.GetRequiredService<GenAIPipelineRegistry>();
+
+        // Act
+        Assert.Equal(PipelineLoadState.NotLoaded, registry.Get<FakePipeline>("fake").State);
+        await registry.LoadAllAsync();
+        var keyed = provider.GetRequiredKeyedService<PipelinePool<FakePipeline>>("fake");
+        var unkeyed = provider.GetRequiredService<PipelinePool<FakePipeline>>();
+
+        // Assert
+        Assert.Equal(3, created);
+        Assert.Equal(PipelineLoadState.Ready, registry.Get<FakePipeline>("fake").State);
+        Assert.Same(keyed, unkeyed);
+        Assert.All(keyed.Replicas, p => Assert.True(p.IsWarm));
+        Assert.Equal(HealthStatus.Healthy, (await CheckHealthAsync(provider)).Status);
+    }
+
+    [Fact]
+    public async Task AddOpenVINOGenAI_FailedReplica_ReportsUnhealthyAndDisposesOthers()
+    {
+        // Arrange
+        var replicas = new List<FakePipeline>();
+        var attempt = 0;
+        using var provider = BuildProvider(o => o.AddPipeline(
+            "fake",
+            () =>
+            {
+                if (Interlocked.Increment(ref attempt) == 2)
+                    throw new InvalidOperationException("compile failed");
+                var pipeline = new FakePipeline();
+                lock (replicas) replicas.Add(pipeline);
+                return pipeline;
+            },
+            replicas: 2));
+        var registry = provider.GetRequiredService<GenAIPipelineRegistry>();
+
+        // Act
+        await Assert.ThrowsAsync<InvalidOperationException>(() => registry.LoadAllAsync());
+        var health = await CheckHealthAsync(provider);
+
+        // Assert
+        Assert.Equal(PipelineLoadState.Failed, registry.Get<FakePipeline>("fake").State);
+        Assert.Equal(HealthStatus.Unhealthy, health.Status);
+        Assert.Contains("compile failed", health.Description);
+        Assert.All(replicas, p => Assert.True(p.IsDisposed));
+    }
+
+    [Fact]
+    public async Task GenAIHealthCheck_WaitingCallers_ReportsDegraded()
+    {
+        // Arrange
+        using var provider = BuildProvider(o => o.AddPipeline("fake", () => new FakePipeline()));
+        var pool = await provider.GetRequiredService<GenAIPipelineRegistry>().Get<FakePipeline>("fake").GetPoolAsync();
+        var lease = await pool.RentAsync();
+
+        // Act
+        var waiter = pool.RentAsync().AsTask();
+        var health = await CheckHealthAsync(provider);
+        lease.Dispose();
+        (await waiter).Dispose();
+
+        // Assert
+        Assert.Equal(HealthStatus.Degraded, health.Status);
+        Assert.Equal(1, health.Data["fake.waiting"]);
+    }
+
+    [Fact]
+    public void AddPipeline_DuplicateName_Throws()
+    {
+        // Arrange
+        var options = new OpenVINOGenAIOptions().AddPipeline("fake", () => new FakePipeline());
+
+        // Act & Assert
+        Assert.Throws<ArgumentException>(() => options.AddPipeline("fake", () => new FakePipeline()));
+        Assert.Throws<ArgumentOutOfRangeException>(() => options.AddPipeline("other", () => new FakePipeline(), replicas: 0));
+    }
+}
@@ -0,0 +1,69 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for GenerationMonitor and LatencyTracker
+/// </summary>
+public class GenerationMonitorTests
+{
+    [Fact]
+    public void GenerationMonitor_Complete_ExcludesTheWaitForThePipeline()
+    {
+        // Arrange
+        var tracker = new LatencyTracker();
+        var monitor = new GenerationMonitor(null, tracker);
+        Thread.Sleep(200);
+
+        // Act
+        monitor.Begin();
+        monitor.OnToken("a"u8);
+        monitor.OnToken("b"u8);
+        monitor.Complete();
+
+        // Assert
+        Assert.True(tracker.TryGetEstimate(out var timeToFirstTokenMs, out _));
+        Assert.InRange(timeToFirstTokenMs, 0, 100);
+        Assert.True(monitor.Elapsed >= TimeSpan.FromMilliseconds(200));
+    }
+
+    [Fact]
+    public void GenerationMonitor_Begin_PlansTokensForTheRestOfTheDeadline()
+    {
+        // Arrange
+        var tracker = new LatencyTracker();
+        tracker.Record(timeToFirstTokenMs: 100, timePerOutputTokenMs: 10);
+        var options = new GenerationOptions().WithDeadline(TimeSpan.FromMilliseconds(1100));
+        var immediate = new GenerationMonitor(options, tracker);
+        var queued = new GenerationMonitor(options, tracker);
+
+        // Act
+        immediate.Begin();
+        Thread.Sleep(500);
+        queued.Begin();
+
+        // Assert
+        Assert.InRange(immediate.TokenLimit!.Value, 95, 101);
+        Assert.InRange(queued.TokenLimit!.Value, 1, 51);
+    }
+
+    [Fact]
+    public void GenerationMonitor_Begin_AfterTheDeadline_StillPlansOneToken()
+    {
+        // Arrange
+        var tracker = new LatencyTracker();
+        tracker.Record(timeToFirstTokenMs: 100, timePerOutputTokenMs: 10);
+        var monitor = new GenerationMonitor(new GenerationOptions().WithDeadline(TimeSpan.FromMilliseconds(50)), tracker);
+        Thread.Sleep(100);
+
+        // Act
+        monitor.Begin();
+        var stop = monitor.OnToken("a"u8);
+
+        // Assert
+        Assert.Equal(1, monitor.TokenLimit);
+        Assert.True(stop);
+        Assert.True(monitor.IsTruncatedByDeadline);
+    }
+}
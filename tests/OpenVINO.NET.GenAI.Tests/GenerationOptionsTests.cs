@@ -0,0 +1,71 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for GenerationOptions
+/// </summary>
+public class GenerationOptionsTests
+{
+    [Fact]
+    public void GenerationOptions_WithDeadline_SetsBudget()
+    {
+        // Arrange
+        var options = new GenerationOptions();
+
+        // Act
+        var result = options.WithDeadline(TimeSpan.FromMilliseconds(1500));
+
+        // Assert
+        Assert.Same(options, result);
+        Assert.Equal(TimeSpan.FromMilliseconds(1500), options.Deadline);
+        Assert.Throws<ArgumentOutOfRangeException>(() => options.WithDeadline(TimeSpan.Zero));
+    }
+
+    [Fact]
+    public void GenerationOptions_StopConditions_ValidateArguments()
+    {
+        // Arrange
+        var options = new GenerationOptions();
+
+        // Act
+        var result = options
+            .StopOn("</tool_call>")
+            .StopWhen(text => text.EndsWith("}".AsSpan()))
+            .StopWhen(new System.Text.RegularExpressions.Regex("</answer>"));
+
+        // Assert
+        Assert.Same(options, result);
+        Assert.Throws<ArgumentException>(() => options.StopOn("</tool_call>", ""));
+        Assert.Throws<ArgumentNullException>(() => options.StopWhen((StopPredicate)null!));
+    }
+
+    [Fact]
+    public void GenerationOptions_StopWhenRegex_MatchesOnlyTheTrailingWindow()
+    {
+        // Arrange
+        var options = new GenerationOptions().StopWhen(new System.Text.RegularExpressions.Regex("</answer>"), window: 16);
+        var condition = options.StopConditions.Single();
+
+        // Act & Assert
+        Assert.True(condition("some text </answer>".AsSpan()));
+        Assert.False(condition(("</answer>" + new string('x', 16)).AsSpan()));
+        Assert.Throws<ArgumentOutOfRangeException>(() => options.StopWhen(new System.Text.RegularExpressions.Regex("x"), window: 0));
+    }
+
+    [Fact]
+    public void GenerationOptions_WithFlushInterval_SetsInterval()
+    {
+        // Arrange
+        var options = new GenerationOptions();
+
+        // Act
+        options.WithFlushInterval(TimeSpan.Zero);
+
+        // Assert
+        Assert.Equal(TimeSpan.Zero, options.FlushInterval);
+        Assert.Equal(GenerationOptions.DefaultFlushInterval, new GenerationOptions().FlushInterval);
+        Assert.Throws<ArgumentOutOfRangeException>(() => options.WithFlushInterval(TimeSpan.FromMilliseconds(-1)));
+    }
+}
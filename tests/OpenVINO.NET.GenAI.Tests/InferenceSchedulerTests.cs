@@ -0,0 +1,94 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for InferenceScheduler
+/// </summary>
+public class InferenceSchedulerTests
+{
+    [Fact]
+    public async Task InferenceScheduler_RunsCallsOnNamedDedicatedThread()
+    {
+        // Arrange
+        using var scheduler = new InferenceScheduler(1, "test inference");
+
+        // Act
+        var thread = await Task.Factory.StartNew(
+            () => Thread.CurrentThread, CancellationToken.None, TaskCreationOptions.None, scheduler);
+
+        // Assert
+        Assert.Equal("test inference", thread.Name);
+        Assert.False(thread.IsThreadPoolThread);
+        Assert.True(thread.IsBackground);
+    }
+
+    [Fact]
+    public async Task InferenceScheduler_BoundsConcurrencyToWorkerCount()
+    {
+        // Arrange
+        using var scheduler = new InferenceScheduler(2);
+        var running = 0;
+        var peak = 0;
+
+        // Act
+        var calls = Enumerable.Range(0, 6).Select(_ => Task.Factory.StartNew(() =>
+        {
+            var current = Interlocked.Increment(ref running);
+            InterlockedMax(ref peak, current);
+            Thread.Sleep(30);
+            Interlocked.Decrement(ref running);
+        }, CancellationToken.None, TaskCreationOptions.None, scheduler)).ToArray();
+        await Task.WhenAll(calls);
+
+        // Assert
+        Assert.Equal(2, scheduler.MaximumConcurrencyLevel);
+        Assert.Equal(2, peak);
+    }
+
+    [Fact]
+    public async Task InferenceScheduler_TracksBusyTime()
+    {
+        // Arrange
+        using var scheduler = new InferenceScheduler();
+
+        // Act
+        await Task.Factory.StartNew(
+            () => Thread.Sleep(50), CancellationToken.None, TaskCreationOptions.None, scheduler);
+
+        // Assert
+        Assert.True(scheduler.BusyTime >= TimeSpan.FromMilliseconds(40));
+        Assert.InRange(scheduler.Utilization, 0.01, 1);
+        Assert.Equal(0, scheduler.BusyWorkers);
+        Assert.Equal(0, scheduler.QueuedCalls);
+    }
+
+    [Fact]
+    public void InferenceScheduler_AfterDispose_RejectsCalls()
+    {
+        // Arrange
+        var scheduler = new InferenceScheduler();
+        scheduler.Dispose();
+
+        // Act & Assert
+        Assert.Throws<ObjectDisposedException>(() => InferenceScheduler.Run(scheduler, () => { }, CancellationToken.None));
+        Assert.Throws<ObjectDisposedException>(() => InferenceScheduler.Run(scheduler, () => 1, CancellationToken.None));
+    }
+
+    [Fact]
+    public void InferenceScheduler_WithInvalidWorkerCount_Throws()
+    {
+        // Act & Assert
+        Assert.Throws<ArgumentOutOfRangeException>(() => new InferenceScheduler(0));
+    }
+
+    private static void InterlockedMax(ref int target, int value)
+    {
+        int current;
+        while ((current = Volatile.Read(ref target)) < value &&
+               Interlocked.CompareExchange(ref target, value, current) != current)
+        {
+        }
+    }
+}
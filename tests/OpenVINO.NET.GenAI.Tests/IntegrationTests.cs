@@ -190,6 +190,262 @@ public class IntegrationTests : IDisposable
         _output.WriteLine($"Second response: {response2.Text}");
     }
 
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task ChatSession_WithEviction_StaysWithinCacheBudget()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        using var pipeline = new LLMPipeline(_modelPath, "CPU");
+        using var session = pipeline.StartChatSession(new CacheEvictionConfig(startSize: 64, recentSize: 64, maxCacheSize: 256));
+        var config = GenerationConfig.Default.WithMaxTokens(40);
+
+        // Act
+        for (int i = 0; i < 8; i++)
+        {
+            var response = await session.SendMessageAsync($"Tell me a fact about the number {i}.", config);
+            Assert.NotEmpty(response.Text);
+            _output.WriteLine($"Turn {i}: {session.CachedTokens} cached tokens ({session.CacheUtilization:P0})");
+        }
+
+        // Assert
+        Assert.True(session.Compactions > 0);
+        Assert.True(session.CachedTokens <= 256 + 128);
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task LLMPipeline_CloneShared_ReplicaGeneratesIndependently()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        using var pipeline = new LLMPipeline(_modelPath, "CPU", new PipelineProperties().WithMmap());
+        using var replica = pipeline.CloneShared();
+        var config = GenerationConfig.Default.WithMaxTokens(10);
+
+        // Act
+        var results = await Task.WhenAll(
+            pipeline.GenerateAsync("The capital of France is", config),
+            replica.GenerateAsync("The capital of France is", config));
+
+        // Assert
+        Assert.NotEmpty(results[0].Text);
+        Assert.Equal(results[0].Text, results[1].Text);
+
+        _output.WriteLine($"First pipeline private memory: {pipeline.PrivateMemoryBytes / (1024 * 1024)} MB");
+        _output.WriteLine($"Shared replica private memory: {replica.PrivateMemoryBytes / (1024 * 1024)} MB");
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task DeviceSelector_SelectAsync_StoresSelectionForModel()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        var cacheFile = Path.Combine(Path.GetTempPath(), $"device-selection-{Guid.NewGuid():N}.json");
+        var selector = new DeviceSelector(cacheFile) { Iterations = 1 };
+        var profile = new WorkloadProfile("test", 16, 4);
+
+        try
+        {
+            // Act
+            var first = await selector.SelectAsync(_modelPath, profile);
+            var second = await selector.SelectAsync(_modelPath, profile);
+
+            // Assert
+            Assert.False(first.FromCache);
+            Assert.Contains(first.Results, r => r.Succeeded);
+            Assert.True(second.FromCache);
+            Assert.Equal(first.Device, second.Device);
+            Assert.Equal(first.Precision, second.Precision);
+
+            foreach (var result in first.Results)
+            {
+                _output.WriteLine(result.Succeeded
+                    ? $"{result.Candidate}: TTFT {result.TimeToFirstTokenMs:F1} ms, TPOT {result.TimePerOutputTokenMs:F1} ms"
+                    : $"{result.Candidate}: {result.Error!.Message}");
+            }
+            _output.WriteLine($"Selected: {first}");
+        }
+        finally
+        {
+            File.Delete(cacheFile);
+        }
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task PerformanceProfile_AutoTuneAsync_StoresBestSettings()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        var storePath = Path.Combine(Path.GetTempPath(), $"performance-profiles-{Guid.NewGuid():N}.json");
+        var workload = new WorkloadProfile("test", 16, 4);
+
+        try
+        {
+            // Act
+            var tuned = await PerformanceProfile.AutoTuneAsync(_modelPath, PerformanceHint.Latency, "CPU", workload, storePath);
+            var stored = await PerformanceProfile.AutoTuneAsync(_modelPath, PerformanceHint.Latency, "CPU", workload, storePath);
+
+            // Assert
+            Assert.True(File.Exists(storePath));
+            Assert.Equal(tuned.ToString(), stored.ToString());
+            using var pool = tuned.CreateLLMPool(_modelPath);
+            Assert.Equal(tuned.PoolSize, pool.Size);
+
+            _output.WriteLine($"Tuned: {tuned}");
+        }
+        finally
+        {
+            File.Delete(storePath);
+        }
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task LLMPipeline_GenerateWithDeadline_StopsEarly()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        using var pipeline = new LLMPipeline(_modelPath, "CPU");
+        using var config = GenerationConfig.Default.WithMaxTokens(200).WithSampling(false);
+        var options = new GenerationOptions().WithDeadline(TimeSpan.FromMilliseconds(500));
+        const string prompt = "Write a long story about a dragon.";
+
+        // Act
+        using var result = await pipeline.GenerateAsync(prompt, config, options);
+        var stream = pipeline.GenerateStreamAsync(prompt, config, options);
+        var streamed = 0;
+        await foreach (var _ in stream)
+        {
+            streamed++;
+        }
+
+        // Assert
+        Assert.True(result.IsTruncatedByDeadline);
+        Assert.True(result.PerformanceMetrics.NumGenerationTokens < 200);
+        Assert.True(stream.IsTruncatedByDeadline);
+        Assert.True(streamed < 200);
+
+        _output.WriteLine($"Generated {result.PerformanceMetrics.NumGenerationTokens} tokens, streamed {streamed} within 500 ms");
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task LLMPipeline_GenerateWithStopCondition_StopsAfterMatch()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        using var pipeline = new LLMPipeline(_modelPath, "CPU");
+        using var config = GenerationConfig.Default.WithMaxTokens(200).WithSampling(false);
+        var options = new GenerationOptions().StopWhen(text => text.IndexOf('.') >= 0);
+        const string prompt = "Write a long story about a dragon.";
+
+        // Act
+        using var result = await pipeline.GenerateAsync(prompt, config, options);
+        var stream = pipeline.GenerateStreamAsync(prompt, config, new GenerationOptions().StopOn("."));
+        var streamed = new List<string>();
+        await foreach (var token in stream)
+        {
+            streamed.Add(token);
+        }
+
+        // Assert
+        Assert.True(result.IsStoppedByCondition);
+        Assert.Contains(".", result.Text);
+        Assert.True(result.PerformanceMetrics.NumGenerationTokens < 200);
+        Assert.True(stream.IsStoppedByCondition);
+        Assert.Contains(".", streamed[^1]);
+        Assert.DoesNotContain(".", string.Concat(streamed.Take(streamed.Count - 1)));
+
+        _output.WriteLine($"Stopped after: {result.Text}");
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task LLMPipeline_GenerateToAsync_WritesFramedTokens()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        using var pipeline = new LLMPipeline(_modelPath, "CPU");
+        using var config = GenerationConfig.Default.WithMaxTokens(20).WithSampling(false);
+        var buffer = new System.Buffers.ArrayBufferWriter<byte>();
+        using var stream = new MemoryStream();
+
+        // Act
+        var ndjson = await pipeline.GenerateToAsync("The capital of France is", buffer, StreamFormat.Ndjson, config);
+        var sse = await pipeline.GenerateToAsync("The capital of France is", stream, StreamFormat.Sse, config);
+
+        // Assert
+        var lines = System.Text.Encoding.UTF8.GetString(buffer.WrittenSpan).Split('\n', StringSplitOptions.RemoveEmptyEntries);
+        Assert.Equal(ndjson.Tokens, lines.Length);
+        Assert.Equal(buffer.WrittenCount, ndjson.BytesWritten);
+        Assert.All(lines, line => System.Text.Json.JsonDocument.Parse(line).RootElement.GetProperty("token").GetString());
+        Assert.Equal(stream.Length, sse.BytesWritten);
+        Assert.StartsWith("data: ", System.Text.Encoding.UTF8.GetString(stream.ToArray()));
+
+        _output.WriteLine(string.Join("", lines));
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task LLMPipeline_ConcurrentCalls_AreSerialized()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        using var pipeline = new LLMPipeline(_modelPath, "CPU") { Scheduler = TaskScheduler.Default };
+        using var config = GenerationConfig.Default.WithMaxTokens(20).WithSampling(false);
+
+        // Act
+        var first = pipeline.GenerateAsync("The capital of France is", config);
+        var second = pipeline.GenerateAsync("The capital of France is", config);
+        using var firstResult = await first;
+        using var secondResult = await second;
+
+        // Assert
+        Assert.Equal(firstResult.Text, secondResult.Text);
+        Assert.Equal(0, pipeline.ActiveGenerations);
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task LLMPipeline_DisposeDuringGeneration_CancelsIt()
+    {
+        Skip.IfNot(_modelAvailable, "Model not available for integration testing");
+
+        // Arrange
+        var pipeline = new LLMPipeline(_modelPath, "CPU");
+        using var config = GenerationConfig.Default.WithMaxTokens(500).WithSampling(false);
+        var streamed = 0;
+
+        // Act
+        var exception = await Assert.ThrowsAsync<ObjectDisposedException>(async () =>
+        {
+            await foreach (var _ in pipeline.GenerateStreamAsync("Write a long story about a dragon.", config))
+            {
+                if (++streamed == 3)
+                {
+                    Assert.Equal(1, pipeline.ActiveGenerations);
+                    pipeline.Dispose();
+                }
+            }
+        });
+
+        // Assert
+        Assert.Equal(nameof(LLMPipeline), exception.ObjectName);
+        Assert.Equal(0, pipeline.ActiveGenerations);
+        Assert.True(streamed < 500);
+    }
+
     private static string GetProjectRoot()
     {
         var directory = new DirectoryInfo(Directory.GetCurrentDirectory());
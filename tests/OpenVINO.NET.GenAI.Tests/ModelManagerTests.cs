@@ -0,0 +1,143 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for ModelManager
+/// </summary>
+public class ModelManagerTests
+{
+    private static ModelManager CreateManager(int capacity, int models, List<FakePipeline> created)
+    {
+        var manager = new ModelManager(capacity * 100L) { EnablePrefetch = false };
+        for (int i = 0; i < models; i++)
+        {
+            manager.Register($"m{i}", () =>
+            {
+                var pipeline = new FakePipeline();
+                lock (created) created.Add(pipeline);
+                return pipeline;
+            }, 100);
+        }
+        return manager;
+    }
+
+    [Fact]
+    public async Task ModelManager_OverBudget_EvictsLeastRecentlyUsedIdleModel()
+    {
+        // Arrange
+        var created = new List<FakePipeline>();
+        using var manager = CreateManager(2, 3, created);
+        using (await manager.AcquireAsync<FakePipeline>("m0")) { }
+        using (await manager.AcquireAsync<FakePipeline>("m1")) { }
+        using (await manager.AcquireAsync<FakePipeline>("m0")) { }
+
+        // Act
+        using var lease = await manager.AcquireAsync<FakePipeline>("m2");
+
+        // Assert
+        Assert.Equal(new[] { "m0", "m2" }, manager.GetLoadedModels().OrderBy(id => id).ToArray());
+        Assert.True(created[1].IsDisposed);
+        Assert.False(created[0].IsDisposed);
+        Assert.Equal(1, manager.Evictions);
+        Assert.Equal(200, manager.MemoryInUse);
+    }
+
+    [Fact]
+    public async Task ModelManager_ConcurrentAcquires_ShareOneLoad()
+    {
+        // Arrange
+        var created = new List<FakePipeline>();
+        using var manager = CreateManager(1, 1, created);
+
+        // Act
+        var leases = await Task.WhenAll(Enumerable.Range(0, 8).Select(_ => manager.AcquireAsync<FakePipeline>("m0")));
+
+        // Assert
+        Assert.Single(created);
+        Assert.All(leases, l => Assert.Same(created[0], l.Pipeline));
+        Assert.Equal(1, manager.Loads);
+        foreach (var lease in leases)
+            lease.Dispose();
+    }
+
+    [Fact]
+    public async Task ModelManager_AllModelsLeased_WaitsForRelease()
+    {
+        // Arrange
+        var created = new List<FakePipeline>();
+        using var manager = CreateManager(1, 2, created);
+        var first = await manager.AcquireAsync<FakePipeline>("m0");
+
+        // Act
+        var second = manager.AcquireAsync<FakePipeline>("m1");
+        await Task.Delay(50);
+        Assert.False(second.IsCompleted);
+        first.Dispose();
+        using var lease = await second;
+
+        // Assert
+        Assert.True(created[0].IsDisposed);
+        Assert.Equal("m1", lease.ModelId);
+    }
+
+    [Fact]
+    public async Task ModelManager_Prefetch_LoadsPredictedSuccessor()
+    {
+        // Arrange
+        var created = new List<FakePipeline>();
+        using var manager = CreateManager(3, 2, created);
+        using (await manager.AcquireAsync<FakePipeline>("m0")) { }
+        using (await manager.AcquireAsync<FakePipeline>("m1")) { }
+        Assert.True(manager.Unload("m1"));
+        manager.EnablePrefetch = true;
+
+        // Act
+        using (await manager.AcquireAsync<FakePipeline>("m0")) { }
+        for (int i = 0; i < 100 && !manager.GetLoadedModels().Contains("m1"); i++)
+            await Task.Delay(10);
+
+        // Assert
+        Assert.Contains("m1", manager.GetLoadedModels());
+        Assert.Equal(3, manager.Loads);
+    }
+
+    [Fact]
+    public async Task ModelManager_LoadFailingAfterDispose_KeepsMemoryAccountingAtZero()
+    {
+        // Arrange
+        using var loading = new ManualResetEventSlim();
+        using var fail = new ManualResetEventSlim();
+        var manager = new ModelManager(100);
+        manager.Register<FakePipeline>("m0", () =>
+        {
+            loading.Set();
+            fail.Wait();
+            throw new InvalidOperationException("load failed");
+        }, 100);
+        var acquire = manager.AcquireAsync<FakePipeline>("m0");
+        loading.Wait();
+
+        // Act
+        manager.Dispose();
+        fail.Set();
+        await Assert.ThrowsAnyAsync<Exception>(() => acquire);
+
+        // Assert
+        Assert.Equal(0, manager.MemoryInUse);
+    }
+
+    [Fact]
+    public async Task ModelManager_Register_ValidatesArguments()
+    {
+        // Arrange
+        using var manager = new ModelManager(100);
+        manager.Register("m0", () => new FakePipeline(), 100);
+
+        // Act & Assert
+        Assert.Throws<ArgumentException>(() => manager.Register("m0", () => new FakePipeline(), 10));
+        Assert.Throws<ArgumentOutOfRangeException>(() => manager.Register("m1", () => new FakePipeline(), 101));
+        await Assert.ThrowsAsync<InvalidOperationException>(() => manager.AcquireAsync<PipelinePool<FakePipeline>>("m0"));
+    }
+}
@@ -0,0 +1,49 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for PerformanceProfile
+/// </summary>
+public class PerformanceProfileTests
+{
+    [Fact]
+    public void PerformanceProfile_Latency_MapsToSingleStreamLatencyHint()
+    {
+        // Act
+        var properties = PerformanceProfile.Latency.CreateProperties(new PipelineProperties().WithCacheDir("cache"));
+
+        // Assert
+        Assert.Equal("LATENCY", properties["PERFORMANCE_HINT"]);
+        Assert.Equal("1", properties["NUM_STREAMS"]);
+        Assert.Equal("cache", properties["CACHE_DIR"]);
+        Assert.Null(properties["KV_CACHE_PRECISION"]);
+        Assert.Equal(1, PerformanceProfile.Latency.PoolSize);
+    }
+
+    [Fact]
+    public void PerformanceProfile_Throughput_SplitsCoresBetweenReplicas()
+    {
+        // Arrange
+        var profile = PerformanceProfile.Throughput;
+
+        // Act
+        var properties = profile.CreateProperties();
+
+        // Assert
+        Assert.Equal("THROUGHPUT", properties["PERFORMANCE_HINT"]);
+        Assert.Null(properties["NUM_STREAMS"]);
+        Assert.Equal("u8", properties["KV_CACHE_PRECISION"]);
+        Assert.True(profile.PoolSize * profile.InferenceNumThreads <= Math.Max(Environment.ProcessorCount, profile.PoolSize));
+        Assert.Null(properties["ENABLE_MMAP"]);
+    }
+
+    [Fact]
+    public void PerformanceProfile_InvalidSettings_ThrowsArgumentOutOfRangeException()
+    {
+        // Act & Assert
+        Assert.Throws<ArgumentOutOfRangeException>(() => new PerformanceProfile("bad", PerformanceHint.Latency, poolSize: 0));
+        Assert.Throws<ArgumentOutOfRangeException>(() => new PerformanceProfile("bad", PerformanceHint.Latency, inferenceNumThreads: 0));
+    }
+}
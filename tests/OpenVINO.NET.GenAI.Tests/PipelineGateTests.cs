@@ -0,0 +1,133 @@
+using System.Runtime.InteropServices;
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for PipelineGate
+/// </summary>
+public class PipelineGateTests
+{
+    private sealed class FakeHandle : SafeHandle
+    {
+        public FakeHandle() : base(IntPtr.Zero, true)
+        {
+            SetHandle((IntPtr)1);
+        }
+
+        public int ReleaseCount { get; private set; }
+
+        public override bool IsInvalid => handle == IntPtr.Zero;
+
+        protected override bool ReleaseHandle()
+        {
+            ReleaseCount++;
+            return true;
+        }
+    }
+
+    [Fact]
+    public void PipelineGate_EnterOnTheHoldingThread_SharesTheCall()
+    {
+        // Arrange
+        var gate = new PipelineGate(new FakeHandle(), "test");
+
+        // Act
+        int nestedActive;
+        using (gate.Enter())
+        {
+            using (gate.Enter())
+            {
+                nestedActive = gate.ActiveCalls;
+            }
+        }
+
+        // Assert
+        Assert.Equal(1, nestedActive);
+        Assert.Equal(0, gate.ActiveCalls);
+    }
+
+    [Fact]
+    public async Task PipelineGate_RunAsync_WaitsWithoutOccupyingTheScheduler()
+    {
+        // Arrange
+        using var scheduler = new InferenceScheduler();
+        var gate = new PipelineGate(new FakeHandle(), "test");
+        using var release = new ManualResetEventSlim();
+        var first = gate.RunAsync(scheduler, () =>
+        {
+            // Calls made by the running call don't wait for it
+            using (gate.Enter())
+            {
+            }
+            release.Wait();
+            return 1;
+        }, CancellationToken.None);
+        SpinWait.SpinUntil(() => scheduler.BusyWorkers == 1, TimeSpan.FromSeconds(5));
+
+        // Act
+        var second = gate.RunAsync(scheduler, () => 2, CancellationToken.None);
+        await Task.Delay(50);
+        var queued = scheduler.QueuedCalls;
+        var active = gate.ActiveCalls;
+        release.Set();
+
+        // Assert
+        Assert.Equal(0, queued);
+        Assert.Equal(2, active);
+        Assert.Equal(1, await first);
+        Assert.Equal(2, await second);
+        Assert.Equal(0, gate.ActiveCalls);
+    }
+
+    [Fact]
+    public async Task PipelineGate_Close_CancelsRunningCallAndRejectsQueuedOnes()
+    {
+        // Arrange
+        var handle = new FakeHandle();
+        var gate = new PipelineGate(handle, "test");
+        using var entered = new ManualResetEventSlim();
+        var running = Task.Run(() =>
+        {
+            using var call = gate.Enter();
+            entered.Set();
+            gate.Closing.WaitHandle.WaitOne();
+        });
+        entered.Wait();
+        var queued = Task.Run(() =>
+        {
+            using var call = gate.Enter();
+        });
+        SpinWait.SpinUntil(() => gate.ActiveCalls == 2, TimeSpan.FromSeconds(5));
+
+        // Act
+        var stillRunning = gate.Close();
+
+        // Assert
+        Assert.Equal(0, stillRunning);
+        Assert.Equal(1, handle.ReleaseCount);
+        await running;
+        await Assert.ThrowsAsync<ObjectDisposedException>(() => queued);
+        await Assert.ThrowsAsync<ObjectDisposedException>(() => gate.RunAsync(TaskScheduler.Default, () => 0, CancellationToken.None));
+    }
+
+    [Fact]
+    public void PipelineGate_CloseFromInsideACall_ReleasesTheHandleWhenTheCallReturns()
+    {
+        // Arrange
+        var handle = new FakeHandle();
+        var gate = new PipelineGate(handle, "test");
+        var call = gate.Enter();
+
+        // Act
+        var stillRunning = gate.Close();
+        var releasedWhileRunning = handle.ReleaseCount;
+        call.Dispose();
+
+        // Assert
+        Assert.Equal(1, stillRunning);
+        Assert.Equal(0, releasedWhileRunning);
+        Assert.Equal(1, handle.ReleaseCount);
+    }
+}
@@ -0,0 +1,125 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for PipelinePool
+/// </summary>
+public class PipelinePoolTests
+{
+    [Fact]
+    public async Task PipelinePool_RentAndReturn_TracksAvailability()
+    {
+        // Arrange
+        using var pool = new PipelinePool<FakePipeline>(() => new FakePipeline(), 2);
+
+        // Act
+        var first = await pool.RentAsync();
+        var rentedSecond = pool.TryRent(out var second);
+        var rentedThird = pool.TryRent(out _);
+
+        // Assert
+        Assert.True(rentedSecond);
+        Assert.False(rentedThird);
+        Assert.Equal(0, pool.Available);
+        Assert.NotSame(first.Pipeline, second!.Pipeline);
+
+        first.Dispose();
+        first.Dispose();
+        Assert.Equal(1, pool.Available);
+
+        second.Dispose();
+        Assert.Equal(2, pool.Available);
+    }
+
+    [Fact]
+    public async Task PipelinePool_RentAsync_WaitsForReturnedReplica()
+    {
+        // Arrange
+        using var pool = new PipelinePool<FakePipeline>(() => new FakePipeline(), 1);
+        var lease = await pool.RentAsync();
+
+        // Act
+        var waiter = pool.RentAsync().AsTask();
+        Assert.False(waiter.IsCompleted);
+        Assert.Equal(1, pool.Waiting);
+        lease.Dispose();
+        using var next = await waiter;
+
+        // Assert
+        Assert.Same(lease.Pipeline, next.Pipeline);
+        Assert.Equal(0, pool.Waiting);
+    }
+
+    [Fact]
+    public void PipelinePool_Dispose_DisposesOwnedReplicasOnly()
+    {
+        // Arrange
+        var external = new FakePipeline();
+        var owned = new PipelinePool<FakePipeline>(() => new FakePipeline(), 1);
+        var borrowed = new PipelinePool<FakePipeline>(new[] { external }, ownsReplicas: false);
+        var ownedReplica = owned.Replicas[0];
+
+        // Act
+        owned.Dispose();
+        borrowed.Dispose();
+
+        // Assert
+        Assert.True(ownedReplica.IsDisposed);
+        Assert.False(external.IsDisposed);
+    }
+
+    [Fact]
+    public void ReplicaPlacement_Partition_SpreadsReplicasAcrossNodesWithDisjointCores()
+    {
+        // Arrange
+        var nodes = new[]
+        {
+            new NumaNode(0, Enumerable.Range(0, 8)),
+            new NumaNode(1, Enumerable.Range(8, 8))
+        };
+
+        // Act
+        var placements = ReplicaPlacement.Partition(4, nodes);
+
+        // Assert
+        Assert.Equal(new[] { 0, 1, 0, 1 }, placements.Select(p => p.Node.Id));
+        Assert.Equal(new[] { 0, 1, 2, 3 }, placements[0].Cpus);
+        Assert.Equal(new[] { 4, 5, 6, 7 }, placements[2].Cpus);
+        Assert.Equal(new[] { 8, 9, 10, 11 }, placements[1].Cpus);
+        Assert.Equal(16, placements.SelectMany(p => p.Cpus).Distinct().Count());
+    }
+
+    [Fact]
+    public void ReplicaPlacement_MoreReplicasThanCores_SharesCores()
+    {
+        // Arrange
+        var nodes = new[] { new NumaNode(0, new[] { 0, 1 }) };
+
+        // Act
+        var placements = ReplicaPlacement.Partition(3, nodes);
+
+        // Assert
+        Assert.All(placements, p => Assert.Single(p.Cpus));
+    }
+
+    [Fact]
+    public void PipelinePool_WithPlacements_CreatesOneReplicaPerPlacement()
+    {
+        // Arrange
+        var placements = ReplicaPlacement.Partition(2, new[] { new NumaNode(0, new[] { 0 }), new NumaNode(1, new[] { 1 }) });
+        var used = new List<ReplicaPlacement>();
+
+        // Act
+        using var pool = new PipelinePool<FakePipeline>(p =>
+        {
+            used.Add(p);
+            return new FakePipeline();
+        }, placements);
+
+        // Assert
+        Assert.Equal(2, pool.Size);
+        Assert.Equal(placements, used);
+    }
+}
@@ -0,0 +1,143 @@
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for PipelineProperties
+/// </summary>
+public class PipelinePropertiesTests
+{
+    [Fact]
+    public void PipelineProperties_TypedSetters_MapToOpenVINOKeys()
+    {
+        // Act
+        var properties = new PipelineProperties()
+            .WithCacheDir("cache")
+            .WithInferenceNumThreads(4)
+            .WithPerformanceHint(PerformanceHint.Latency)
+            .WithNumStreams(1)
+            .WithInferencePrecision(InferencePrecision.F16)
+            .WithInferenceNumThreads(8);
+
+        // Assert
+        Assert.Equal(5, properties.Count);
+        Assert.Equal("cache", properties["CACHE_DIR"]);
+        Assert.Equal("8", properties["INFERENCE_NUM_THREADS"]);
+        Assert.Equal("LATENCY", properties["PERFORMANCE_HINT"]);
+        Assert.Equal("1", properties["NUM_STREAMS"]);
+        Assert.Equal("f16", properties["INFERENCE_PRECISION_HINT"]);
+    }
+
+    [Fact]
+    public void PipelineProperties_WithMmap_SetsEnableMmap()
+    {
+        // Act
+        var properties = new PipelineProperties().WithMmap().WithMmap(false).WithMmap();
+
+        // Assert
+        Assert.Single(properties);
+        Assert.Equal("YES", properties["ENABLE_MMAP"]);
+    }
+
+    [Fact]
+    public void PipelineProperties_WithCpuPinning_SetsEnableCpuPinning()
+    {
+        // Act
+        var properties = new PipelineProperties().WithCpuPinning().WithInferenceNumThreads(8);
+
+        // Assert
+        Assert.Equal("YES", properties["ENABLE_CPU_PINNING"]);
+        Assert.Equal("8", properties["INFERENCE_NUM_THREADS"]);
+    }
+
+    [Fact]
+    public void PipelineProperties_WithKVCachePrecision_SetsKVCachePrecision()
+    {
+        // Act
+        var properties = new PipelineProperties().WithKVCachePrecision(KVCachePrecision.U8);
+
+        // Assert
+        Assert.Equal("u8", properties["KV_CACHE_PRECISION"]);
+    }
+
+    [Fact]
+    public void PipelineProperties_TooManyProperties_Throws()
+    {
+        // Arrange
+        var properties = new PipelineProperties();
+        for (int i = 0; i < PipelineProperties.MaxCount; i++)
+        {
+            properties.Set($"KEY_{i}", "value");
+        }
+
+        // Act & Assert
+        Assert.Throws<InvalidOperationException>(() => properties.Set("ONE_MORE", "value"));
+    }
+
+    [Fact]
+    public void PipelineProperties_SetAtMaxCount_ReplacesAnExistingProperty()
+    {
+        // Arrange
+        var properties = new PipelineProperties();
+        for (int i = 0; i < PipelineProperties.MaxCount; i++)
+        {
+            properties.Set($"KEY_{i}", "value");
+        }
+
+        // Act
+        properties.Set("KEY_0", "replaced");
+
+        // Assert
+        Assert.Equal(PipelineProperties.MaxCount, properties.Count);
+        Assert.Equal("replaced", properties["KEY_0"]);
+    }
+
+    [Fact]
+    public void PipelineProperties_FromDictionary_TooManyProperties_Throws()
+    {
+        // Arrange
+        var dictionary = Enumerable.Range(0, PipelineProperties.MaxCount + 1)
+            .ToDictionary(i => $"KEY_{i}", i => "value");
+
+        // Act & Assert
+        Assert.Throws<InvalidOperationException>(() => PipelineProperties.FromDictionary(dictionary));
+    }
+
+    [Fact]
+    public void PipelineProperties_ToNativeArgs_PadsPairsWithNulls()
+    {
+        // Arrange
+        var properties = new PipelineProperties()
+            .WithCacheDir("cache")
+            .WithNumStreams(2);
+
+        // Act
+        var args = properties.ToNativeArgs();
+
+        // Assert
+        Assert.Equal(PipelineProperties.MaxCount * 2, args.Length);
+        Assert.Equal(new[] { "CACHE_DIR", "cache", "NUM_STREAMS", "2" }, args.Take(4));
+        Assert.All(args.Skip(4), arg => Assert.Null(arg));
+    }
+
+    [Fact]
+    public void PipelineProperties_ToNativeArgs_AtMaxCount_UsesEverySlot()
+    {
+        // Arrange
+        var properties = new PipelineProperties();
+        for (int i = 0; i < PipelineProperties.MaxCount; i++)
+        {
+            properties.Set($"KEY_{i}", $"value {i}");
+        }
+
+        // Act
+        var args = properties.ToNativeArgs();
+
+        // Assert
+        Assert.Equal(PipelineProperties.MaxCount * 2, args.Length);
+        Assert.Equal($"KEY_{PipelineProperties.MaxCount - 1}", args[^2]);
+        Assert.Equal($"value {PipelineProperties.MaxCount - 1}", args[^1]);
+        Assert.All(args, arg => Assert.NotNull(arg));
+    }
+}
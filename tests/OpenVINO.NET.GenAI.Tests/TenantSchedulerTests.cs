@@ -0,0 +1,238 @@
+using Fluid.OpenVINO.GenAI;
+using Fluid.OpenVINO.GenAI.Exceptions;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for TenantScheduler
+/// </summary>
+public class TenantSchedulerTests
+{
+    private static TenantScheduler<FakePipeline> CreateScheduler()
+        => new(new PipelinePool<FakePipeline>(() => new FakePipeline(), 1), ownsPool: true);
+
+    [Fact]
+    public async Task TenantScheduler_HighPriority_IsServedFirst()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        scheduler.ConfigureTenant("batch", new TenantLimits { Priority = RequestPriority.Low });
+        scheduler.ConfigureTenant("interactive", new TenantLimits { Priority = RequestPriority.High });
+        var blocker = await scheduler.AcquireAsync("batch", 10, 10);
+
+        // Act
+        var low = scheduler.AcquireAsync("batch", 10, 10);
+        var high = scheduler.AcquireAsync("interactive", 10, 10);
+        blocker.Dispose();
+        var first = await Task.WhenAny(low, high);
+
+        // Assert
+        Assert.Same(high, first);
+        Assert.False(low.IsCompleted);
+        (await high).Dispose();
+        (await low).Dispose();
+    }
+
+    [Fact]
+    public async Task TenantScheduler_Weights_ShareReplicasProportionally()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        scheduler.ConfigureTenant("heavy", new TenantLimits { Weight = 3 });
+        scheduler.ConfigureTenant("light", new TenantLimits { Weight = 1 });
+        var blocker = await scheduler.AcquireAsync("light", 0, 0);
+        var pending = new List<Task<TenantLease<FakePipeline>>>();
+        for (int i = 0; i < 4; i++)
+        {
+            pending.Add(scheduler.AcquireAsync("heavy", 50, 50));
+            pending.Add(scheduler.AcquireAsync("light", 50, 50));
+        }
+
+        // Act
+        var order = new List<string>();
+        blocker.Dispose();
+        while (pending.Count > 0)
+        {
+            var next = await Task.WhenAny(pending);
+            pending.Remove(next);
+            using var lease = await next;
+            order.Add(lease.TenantId);
+        }
+
+        // Assert
+        Assert.Equal(3, order.Take(4).Count(t => t == "heavy"));
+    }
+
+    [Fact]
+    public async Task TenantScheduler_GeneratedTokenLimit_DelaysNextRequest()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        scheduler.ConfigureTenant("tenant", new TenantLimits { GeneratedTokensPerSecond = 1000, GeneratedTokenBurst = 100 });
+
+        // Act
+        using (var lease = await scheduler.AcquireAsync("tenant", 10, 100))
+        {
+            lease.ReportGeneratedTokens(200);
+        }
+        using var next = await scheduler.AcquireAsync("tenant", 10, 100);
+
+        // Assert
+        Assert.True(next.QueueTime >= TimeSpan.FromMilliseconds(50), $"Queue time was {next.QueueTime}");
+    }
+
+    [Fact]
+    public async Task TenantScheduler_FullQueue_RejectsRequest()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        scheduler.ConfigureTenant("tenant", new TenantLimits { MaxQueuedRequests = 1 });
+        using var running = await scheduler.AcquireAsync("tenant", 1, 1);
+        var queued = scheduler.AcquireAsync("tenant", 1, 1);
+
+        // Act & Assert
+        var ex = await Assert.ThrowsAsync<TenantQueueFullException>(() => scheduler.AcquireAsync("tenant", 1, 1));
+        Assert.Equal("tenant", ex.TenantId);
+        Assert.Equal(1, scheduler.GetStatistics("tenant")!.RejectedRequests);
+        Assert.False(queued.IsCompleted);
+    }
+
+    [Fact]
+    public async Task TenantScheduler_Statistics_CountReportedTokens()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+
+        // Act
+        var result = await scheduler.RunAsync("tenant", 40, 20, (lease, _) =>
+        {
+            lease.ReportPromptTokens(32);
+            lease.ReportGeneratedTokens(12);
+            return Task.FromResult(lease.TenantId);
+        });
+        var statistics = scheduler.GetStatistics("tenant")!;
+
+        // Assert
+        Assert.Equal("tenant", result);
+        Assert.Equal(1, statistics.CompletedRequests);
+        Assert.Equal(0, statistics.RunningRequests);
+        Assert.Equal(32, statistics.PromptTokens);
+        Assert.Equal(12, statistics.GeneratedTokens);
+        Assert.Null(scheduler.GetStatistics("unknown"));
+    }
+
+    [Fact]
+    public async Task TenantScheduler_CancelledRequest_LeavesQueue()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        var running = await scheduler.AcquireAsync("tenant", 1, 1);
+        using var cts = new CancellationTokenSource();
+        var queued = scheduler.AcquireAsync("tenant", 1, 1, cts.Token);
+
+        // Act
+        cts.Cancel();
+
+        // Assert
+        await Assert.ThrowsAnyAsync<OperationCanceledException>(() => queued);
+        Assert.Equal(0, scheduler.GetStatistics("tenant")!.QueuedRequests);
+        running.Dispose();
+    }
+
+    [Fact]
+    public async Task TenantScheduler_CancelledRequest_DoesNotDelayTenant()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        var blocker = await scheduler.AcquireAsync("b", 25, 25);
+        using var cts = new CancellationTokenSource();
+        var cancelled = scheduler.AcquireAsync("a", 50, 50, cts.Token);
+        cts.Cancel();
+        await Assert.ThrowsAnyAsync<OperationCanceledException>(() => cancelled);
+
+        // Act
+        var a = scheduler.AcquireAsync("a", 50, 50);
+        var b = scheduler.AcquireAsync("b", 50, 50);
+        blocker.Dispose();
+        var first = await Task.WhenAny(a, b);
+
+        // Assert
+        Assert.Same(a, first);
+        (await a).Dispose();
+        (await b).Dispose();
+    }
+
+    [Fact]
+    public async Task TenantScheduler_ConfigureTenant_KeepsRateLimitDebt()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        var limits = new TenantLimits { GeneratedTokensPerSecond = 1000, GeneratedTokenBurst = 100 };
+        scheduler.ConfigureTenant("tenant", limits);
+        using (var lease = await scheduler.AcquireAsync("tenant", 10, 100))
+        {
+            lease.ReportGeneratedTokens(200);
+        }
+
+        // Act
+        scheduler.ConfigureTenant("tenant", limits);
+        using var next = await scheduler.AcquireAsync("tenant", 10, 100);
+
+        // Assert
+        Assert.True(next.QueueTime >= TimeSpan.FromMilliseconds(50), $"Queue time was {next.QueueTime}");
+    }
+
+    [Fact]
+    public void TenantScheduler_InvalidLimits_Throws()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+
+        // Act & Assert
+        Assert.Throws<ArgumentOutOfRangeException>(() => scheduler.ConfigureTenant("tenant", new TenantLimits { Weight = 0 }));
+        Assert.Throws<ArgumentOutOfRangeException>(() => scheduler.ConfigureTenant("tenant", new TenantLimits { GeneratedTokensPerSecond = -1 }));
+    }
+
+    [Fact]
+    public async Task TenantSchedulerExtensions_WithoutConfig_ChargesDefaultEstimate()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+
+        // Act
+        var estimate = TenantSchedulerExtensions.EstimateGeneratedTokens(null);
+        using var lease = await scheduler.AcquireAsync("tenant", 1, estimate);
+
+        // Assert
+        Assert.Equal(TenantSchedulerExtensions.DefaultEstimatedTokens, estimate);
+    }
+
+    [Fact]
+    public async Task TenantSchedulerExtensions_ConfigWithoutMaxTokens_ChargesPositiveEstimate()
+    {
+        // Arrange
+        using var scheduler = CreateScheduler();
+        using var config = new GenerationConfig();
+
+        // Act
+        var estimate = TenantSchedulerExtensions.EstimateGeneratedTokens(config);
+        using var lease = await scheduler.AcquireAsync("tenant", 1, estimate);
+
+        // Assert
+        Assert.True(config.GetMaxNewTokens() > 0);
+        Assert.Equal(TenantSchedulerExtensions.DefaultEstimatedTokens, estimate);
+    }
+
+    [Fact]
+    public void TenantSchedulerExtensions_ConfigWithMaxTokens_ChargesCappedLimit()
+    {
+        // Arrange
+        using var small = new GenerationConfig().WithMaxTokens(100);
+        using var large = new GenerationConfig().WithMaxTokens(1_000_000);
+
+        // Act & Assert
+        Assert.Equal(100, TenantSchedulerExtensions.EstimateGeneratedTokens(small));
+        Assert.Equal(TenantSchedulerExtensions.MaxEstimatedTokens, TenantSchedulerExtensions.EstimateGeneratedTokens(large));
+    }
+}
@@ -0,0 +1,128 @@
+using System.Text;
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for TranscriptionCache
+/// </summary>
+public class TranscriptionCacheTests : IDisposable
+{
+    private readonly string _directory = Path.Combine(Path.GetTempPath(), $"transcription-cache-{Guid.NewGuid():N}");
+
+    public void Dispose()
+    {
+        if (Directory.Exists(_directory))
+            Directory.Delete(_directory, recursive: true);
+    }
+
+    private static CachedTranscription CreateEntry(string text)
+    {
+        var chunks = new WhisperChunkBuffer(2);
+        chunks.Add(0.0f, 1.5f, Encoding.UTF8.GetBytes(text));
+        chunks.Add(1.5f, 3.0f, Encoding.UTF8.GetBytes(" und weiter"));
+        return new CachedTranscription(new[] { text + " und weiter" }, new[] { -0.25f }, chunks);
+    }
+
+    private string GetEntryPath(string key) => Path.Combine(_directory, key.Substring(0, 2), key + ".bin");
+
+    [Fact]
+    public void TranscriptionCache_ComputeKey_DependsOnAudioSettingsAndModel()
+    {
+        // Arrange
+        var audio = new[] { 0.1f, -0.2f, 0.3f };
+        var otherAudio = new[] { 0.1f, -0.2f, 0.31f };
+
+        // Act
+        var key = TranscriptionCache.ComputeKey(audio, "settings", "model");
+
+        // Assert
+        Assert.Equal(key, TranscriptionCache.ComputeKey(audio.ToArray(), "settings", "model"));
+        Assert.NotEqual(key, TranscriptionCache.ComputeKey(otherAudio, "settings", "model"));
+        Assert.NotEqual(key, TranscriptionCache.ComputeKey(audio, "other settings", "model"));
+        Assert.NotEqual(key, TranscriptionCache.ComputeKey(audio, "settings", "other model"));
+    }
+
+    [Fact]
+    public void TranscriptionCache_AtMemoryCapacity_EvictsLeastRecentlyUsed()
+    {
+        // Arrange
+        var cache = new TranscriptionCache(memoryCapacity: 2);
+        cache.Set("a", CreateEntry("a"));
+        cache.Set("b", CreateEntry("b"));
+
+        // Act
+        cache.TryGet("a", out _);
+        cache.Set("c", CreateEntry("c"));
+
+        // Assert
+        Assert.Equal(2, cache.Count);
+        Assert.True(cache.TryGet("a", out _));
+        Assert.False(cache.TryGet("b", out _));
+        Assert.True(cache.TryGet("c", out _));
+    }
+
+    [Fact]
+    public void TranscriptionCache_DiskEntry_ReadsBackTheSame()
+    {
+        // Arrange
+        var key = TranscriptionCache.ComputeKey(new[] { 0.5f }, "settings", "model");
+        var entry = CreateEntry("Grüße");
+        new TranscriptionCache(directory: _directory).Set(key, entry);
+
+        // Act
+        var found = new TranscriptionCache(directory: _directory).TryGet(key, out var read);
+
+        // Assert
+        Assert.True(found);
+        Assert.Equal(entry.Texts, read.Texts);
+        Assert.Equal(entry.Scores, read.Scores);
+        Assert.NotNull(read.Chunks);
+        Assert.Equal(entry.Chunks!.StartTimes.ToArray(), read.Chunks!.StartTimes.ToArray());
+        Assert.Equal(entry.Chunks.EndTimes.ToArray(), read.Chunks.EndTimes.ToArray());
+        Assert.Equal("Grüße", read.Chunks.GetText(0));
+        Assert.Equal(" und weiter", read.Chunks.GetText(1));
+    }
+
+    [Theory]
+    [InlineData("truncated")]
+    [InlineData("garbage")]
+    [InlineData("oversized result count")]
+    [InlineData("oversized chunk count")]
+    public void TranscriptionCache_DamagedDiskEntry_IsAMiss(string damage)
+    {
+        // Arrange
+        var key = TranscriptionCache.ComputeKey(new[] { 0.5f }, "settings", "model");
+        new TranscriptionCache(directory: _directory).Set(key, CreateEntry("text"));
+        var path = GetEntryPath(key);
+        var bytes = File.ReadAllBytes(path);
+        var header = 4 + sizeof(int);
+        switch (damage)
+        {
+            case "truncated":
+                bytes = bytes.AsSpan(0, bytes.Length - 6).ToArray();
+                break;
+            case "garbage":
+                new Random(42).NextBytes(bytes);
+                break;
+            case "oversized result count":
+                BitConverter.TryWriteBytes(bytes.AsSpan(header), int.MaxValue);
+                break;
+            case "oversized chunk count":
+                // The chunk count follows the results and the has-chunks flag
+                var chunkCountOffset = header + sizeof(int) + 1 + "text und weiter".Length + sizeof(float) + 1;
+                BitConverter.TryWriteBytes(bytes.AsSpan(chunkCountOffset), int.MaxValue);
+                break;
+        }
+        File.WriteAllBytes(path, bytes);
+        var cache = new TranscriptionCache(directory: _directory);
+
+        // Act
+        var found = cache.TryGet(key, out _);
+
+        // Assert
+        Assert.False(found);
+        Assert.Equal(1, cache.Misses);
+    }
+}
@@ -0,0 +1,116 @@
+using System.Buffers;
+using System.IO.Pipelines;
+using System.Text;
+using Fluid.OpenVINO.GenAI;
+using Xunit;
+
+namespace Fluid.OpenVINO.GenAI.Tests;
+
+/// <summary>
+/// Unit tests for Utf8FrameWriter
+/// </summary>
+public class Utf8FrameWriterTests
+{
+    private static string WriteTokens(StreamFormat format, params string[] tokens)
+    {
+        var output = new ArrayBufferWriter<byte>();
+        var frames = new Utf8FrameWriter(output, format, TimeSpan.Zero);
+        foreach (var token in tokens)
+            frames.WriteToken(Encoding.UTF8.GetBytes(token));
+
+        Assert.Equal(output.WrittenCount, frames.BytesWritten);
+        return Encoding.UTF8.GetString(output.WrittenSpan);
+    }
+
+    [Fact]
+    public void Utf8FrameWriter_Sse_WritesOneEventPerToken()
+    {
+        // Act
+        var text = WriteTokens(StreamFormat.Sse, "Hello", " wörld");
+
+        // Assert
+        Assert.Equal("data: Hello\n\ndata:  wörld\n\n", text);
+    }
+
+    [Fact]
+    public void Utf8FrameWriter_Sse_SplitsLineBreaksIntoDataLines()
+    {
+        // Act
+        var text = WriteTokens(StreamFormat.Sse, "a\r\nb\nc\r");
+
+        // Assert
+        Assert.Equal("data: a\ndata: b\ndata: c\ndata: \n\n", text);
+    }
+
+    [Fact]
+    public void Utf8FrameWriter_Ndjson_EscapesTokens()
+    {
+        // Act
+        var text = WriteTokens(StreamFormat.Ndjson, "say \"hi\"\n", "é");
+
+        // Assert
+        Assert.Equal("{\"token\":\"say \\\"hi\\\"\\n\"}\n{\"token\":\"é\"}\n", text);
+    }
+
+    [Fact]
+    public void Utf8FrameWriter_Ndjson_WritesChunkTimes()
+    {
+        // Arrange
+        var output = new ArrayBufferWriter<byte>();
+        var frames = new Utf8FrameWriter(output, StreamFormat.Ndjson, TimeSpan.Zero);
+
+        // Act
+        frames.WriteChunk(new WhisperChunk(1.5f, 3f, "Hi"));
+
+        // Assert
+        Assert.Equal("{\"start\":1.5,\"end\":3,\"text\":\"Hi\"}\n", Encoding.UTF8.GetString(output.WrittenSpan));
+    }
+
+    [Fact]
+    public async Task Utf8FrameWriter_FlushIfDue_DoesNotWaitForASlowReader()
+    {
+        // Arrange
+        var pipe = new Pipe(new PipeOptions(pauseWriterThreshold: 1, resumeWriterThreshold: 1));
+        var frames = new Utf8FrameWriter(pipe.Writer, StreamFormat.Raw, TimeSpan.Zero);
+
+        // Act
+        frames.WriteToken("one"u8);
+        var first = frames.FlushIfDue(CancellationToken.None);
+        frames.WriteToken(" two"u8);
+        var second = frames.FlushIfDue(CancellationToken.None);
+
+        var read = await pipe.Reader.ReadAsync();
+        var beforeBacklog = Encoding.UTF8.GetString(read.Buffer.ToArray());
+        pipe.Reader.AdvanceTo(read.Buffer.End);
+
+        var flush = frames.FlushAsync(CancellationToken.None);
+        read = await pipe.Reader.ReadAsync();
+        var afterBacklog = Encoding.UTF8.GetString(read.Buffer.ToArray());
+        pipe.Reader.AdvanceTo(read.Buffer.End);
+        await flush;
+
+        // Assert
+        Assert.True(first);
+        Assert.True(second);
+        Assert.Equal("one", beforeBacklog);
+        Assert.Equal(" two", afterBacklog);
+        Assert.False(frames.IsReaderStalled);
+    }
+
+    [Fact]
+    public async Task Utf8FrameWriter_FlushIfDue_StopsWhenTheReaderCompletes()
+    {
+        // Arrange
+        var pipe = new Pipe();
+        var frames = new Utf8FrameWriter(pipe.Writer, StreamFormat.Sse, TimeSpan.Zero);
+        await pipe.Reader.CompleteAsync();
+
+        // Act
+        frames.WriteToken("token"u8);
+        var keepGoing = frames.FlushIfDue(CancellationToken.None);
+
+        // Assert
+        Assert.False(keepGoing);
+        Assert.True(frames.IsReaderCompleted);
+    }
+}
@@ -308,6 +308,77 @@ public class WhisperIntegrationTests : IDisposable
         }
     }
 
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task WhisperPipeline_StreamingGeneration_YieldsChunksInOrder()
+    {
+        Skip.IfNot(_modelAvailable, "Whisper model not available for integration testing");
+
+        // Arrange
+        using var pipeline = new WhisperPipeline(_modelPath, "CPU");
+        var config = WhisperGenerationConfig.Default
+            .WithLanguage("en")
+            .WithTask(WhisperTask.Transcribe);
+
+        // Long enough to span more than one 30 second window
+        var testAudio = GenerateTestAudio(45.0f);
+        var chunks = new List<WhisperChunk>();
+
+        // Act
+        await foreach (var chunk in pipeline.GenerateStreamAsync(testAudio, config))
+        {
+            chunks.Add(chunk);
+            _output.WriteLine($"  {chunk}");
+        }
+
+        // Assert
+        Assert.NotEmpty(chunks);
+        for (int i = 1; i < chunks.Count; i++)
+        {
+            Assert.True(chunks[i].StartTime >= chunks[i - 1].StartTime);
+        }
+        Assert.True(chunks[^1].EndTime <= 45.0f + 0.01f);
+    }
+
+    [SkippableFact]
+    [Trait("Category", "Integration")]
+    public async Task WhisperPipeline_WithCache_RepeatedAudioIsServedFromCache()
+    {
+        Skip.IfNot(_modelAvailable, "Whisper model not available for integration testing");
+
+        // Arrange
+        var cacheDir = Path.Combine(Path.GetTempPath(), Guid.NewGuid().ToString());
+        try
+        {
+            using var pipeline = new WhisperPipeline(_modelPath, "CPU");
+            pipeline.Cache = new TranscriptionCache(directory: cacheDir);
+            var config = WhisperGenerationConfig.Default
+                .WithLanguage("en")
+                .WithTimestamps(true);
+            var testAudio = GenerateTestAudio(3.0f);
+
+            // Act
+            var first = await pipeline.GenerateAsync(testAudio, config);
+            var second = await pipeline.GenerateAsync(testAudio, config);
+
+            // A fresh cache over the same directory is served from disk
+            pipeline.Cache = new TranscriptionCache(directory: cacheDir);
+            var third = await pipeline.GenerateAsync(testAudio, config);
+
+            // Assert
+            Assert.Equal(first[0].Text, second[0].Text);
+            Assert.Equal(first[0].ChunkCount, second[0].ChunkCount);
+            Assert.Equal(first[0].Text, third[0].Text);
+            Assert.Equal(1, pipeline.Cache.Hits);
+            Assert.Null(third[0].PerformanceMetrics);
+        }
+        finally
+        {
+            if (Directory.Exists(cacheDir))
+                Directory.Delete(cacheDir, true);
+        }
+    }
+
     /// <summary>
     /// Generates test audio data (sine wave to simulate speech patterns)
     /// </summary>
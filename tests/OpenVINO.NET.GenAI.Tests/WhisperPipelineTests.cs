@@ -49,6 +49,119 @@ public class WhisperPipelineTests
         Assert.NotNull(config2);
     }
 
+    [Fact]
+    public void WhisperGenerationConfig_WithLanguage_AcceptsCodeAndToken()
+    {
+        // Arrange
+        using var fromCode = new WhisperGenerationConfig();
+        using var fromToken = new WhisperGenerationConfig();
+
+        // Act
+        fromCode.WithLanguage("en");
+        fromToken.WithLanguage("<|en|>");
+
+        // Assert
+        Assert.Contains("language=<|en|>\n", fromCode.Fingerprint);
+        Assert.Equal(fromCode.Fingerprint, fromToken.Fingerprint);
+        Assert.Throws<ArgumentException>(() => fromCode.WithLanguage("english"));
+    }
+
+    [Theory]
+    [InlineData("en", "<|en|>")]
+    [InlineData("<|EN|>", "<|en|>")]
+    [InlineData(" haw ", "<|haw|>")]
+    public void WhisperLanguageDetectionResult_ToLanguageToken_NormalizesCodesAndTokens(string language, string expected)
+    {
+        // Act & Assert
+        Assert.Equal(expected, WhisperLanguageDetectionResult.ToLanguageToken(language));
+    }
+
+    [Theory]
+    [InlineData("english")]
+    [InlineData("e")]
+    [InlineData("<|e1|>")]
+    [InlineData("<||>")]
+    public void WhisperLanguageDetectionResult_ToLanguageToken_InvalidCode_Throws(string language)
+    {
+        // Act & Assert
+        Assert.Throws<ArgumentException>(() => WhisperLanguageDetectionResult.ToLanguageToken(language));
+    }
+
+    [Fact]
+    public void WhisperGenerationConfig_DecodingSettings_RoundTrip()
+    {
+        // Arrange
+        using var config = new WhisperGenerationConfig();
+
+        // Act
+        config.WithMaxTokens(64)
+            .WithNumBeams(1)
+            .WithSilenceThreshold(-50f)
+            .WithCompressionRatioThreshold(2.4f)
+            .WithTemperatureFallback(0.2f, 0.4f);
+
+        // Assert
+        Assert.Equal(64, config.GetMaxNewTokens());
+        Assert.Equal(-50f, config.SilenceThresholdDbfs);
+        Assert.Equal(2.4f, config.CompressionRatioThreshold);
+        Assert.Equal(new[] { 0.2f, 0.4f }, config.TemperatureFallback);
+    }
+
+    [Fact]
+    public void WhisperGenerationConfig_WithEstimatedWordTimings_Disabling_RestoresTimestamps()
+    {
+        // Arrange
+        using var config = new WhisperGenerationConfig().WithTimestamps(false);
+        using var timestamped = new WhisperGenerationConfig().WithTimestamps(true);
+
+        // Act
+        config.WithEstimatedWordTimings();
+        var enabled = config.GetReturnTimestamps();
+        config.WithEstimatedWordTimings(false);
+        timestamped.WithEstimatedWordTimings().WithEstimatedWordTimings(false);
+
+        // Assert
+        Assert.True(enabled);
+        Assert.False(config.GetReturnTimestamps());
+        Assert.True(timestamped.GetReturnTimestamps());
+    }
+
+    [Fact]
+    public void WhisperGenerationConfig_WithNumBeams_Zero_Throws()
+    {
+        // Arrange
+        using var config = new WhisperGenerationConfig();
+
+        // Act & Assert
+        Assert.Throws<ArgumentOutOfRangeException>(() => config.WithNumBeams(0));
+    }
+
+    [Fact]
+    public void WhisperLanguageDetectionResult_SelectsMostLikelyLanguage()
+    {
+        // Arrange
+        var confidences = new Dictionary<string, float> { ["en"] = 0.2f, ["de"] = 0.7f, ["fr"] = 0.1f };
+
+        // Act
+        var result = new WhisperLanguageDetectionResult(confidences);
+
+        // Assert
+        Assert.Equal("de", result.Language);
+        Assert.Equal(0.7f, result.Confidence, 0.001f);
+        Assert.Equal(3, result.Confidences.Count);
+    }
+
+    [Fact]
+    public void WhisperLanguageDetectionResult_DefaultCandidates_AreFewDistinctCodes()
+    {
+        // Act
+        var candidates = WhisperLanguageDetectionResult.DefaultCandidates;
+
+        // Assert
+        Assert.InRange(candidates.Count, 2, 5);
+        Assert.Equal(candidates.Count, candidates.Distinct().Count());
+    }
+
     [Fact]
     public void WhisperGenerationConfig_Dispose_MultipleCalls_DoesNotThrow()
     {
@@ -183,6 +296,25 @@ public class WhisperPipelineTests
         Assert.Equal(2, result.Chunks.Count);
     }
 
+    [Fact]
+    public void WhisperDecodedResult_ChunkCount_MatchesChunks()
+    {
+        // Arrange
+        var chunks = new List<WhisperChunk>
+        {
+            new WhisperChunk(0.0f, 1.5f, "Hello"),
+            new WhisperChunk(1.5f, 3.0f, "world")
+        };
+
+        // Act
+        var withChunks = new WhisperDecodedResult("Hello world", 0.95f, chunks);
+        var withoutChunks = new WhisperDecodedResult("Hello world", 0.95f);
+
+        // Assert
+        Assert.Equal(2, withChunks.ChunkCount);
+        Assert.Equal(0, withoutChunks.ChunkCount);
+    }
+
     [Fact]
     public void WhisperDecodedResult_NoChunks_HasChunksReturnsFalse()
     {
@@ -194,6 +326,72 @@ public class WhisperPipelineTests
         Assert.Null(result.Chunks);
     }
 
+    [Fact]
+    public void WhisperWordCollection_EstimateFromSegments_SplitsWordsWithinSegmentBounds()
+    {
+        // Arrange
+        var segments = new List<(float, float, string)>
+        {
+            (0.0f, 1.0f, " Hi there"),
+            (1.0f, 3.0f, " Good morning, world.")
+        };
+
+        // Act
+        var words = WhisperWordCollection.EstimateFromSegments(segments);
+
+        // Assert
+        Assert.Equal(5, words.Count);
+        Assert.Equal("Hi", words[0].Text.ToString());
+        Assert.Equal("world.", words[4].Text.ToString());
+        Assert.Equal(0.0f, words[0].StartTime, 0.001f);
+        Assert.Equal(1.0f, words[1].EndTime, 0.001f);
+        Assert.Equal(1.0f, words[2].StartTime, 0.001f);
+        Assert.Equal(3.0f, words[4].EndTime, 0.001f);
+        for (int i = 1; i < words.Count; i++)
+        {
+            Assert.True(words[i].StartTime >= words[i - 1].EndTime - 0.001f);
+        }
+    }
+
+    [Fact]
+    public void WhisperPerformanceMetrics_DerivedValues_ComputedFromTimings()
+    {
+        // Arrange & Act
+        var metrics = new WhisperPerformanceMetrics(
+            audioDuration: 10.0f,
+            generateDuration: 500.0f,
+            inferenceDuration: 450.0f,
+            timeToFirstToken: 120.0f,
+            timePerOutputToken: 20.0f,
+            throughput: 50.0f,
+            numGeneratedTokens: 20);
+
+        // Assert
+        Assert.Equal(0.05f, metrics.RealTimeFactor, 0.0001f);
+        Assert.Equal(100.0f, metrics.FeatureExtractionAndEncodeTime, 0.001f);
+        Assert.Equal(400.0f, metrics.DecodeTime, 0.001f);
+    }
+
+    [Fact]
+    public void WhisperPerformanceMetrics_Combine_SumsEachWindowsEncodeTime()
+    {
+        // Arrange
+        var windows = new[]
+        {
+            new WhisperPerformanceMetrics(30f, 500f, 450f, 120f, 20f, 50f, 20),
+            new WhisperPerformanceMetrics(30f, 400f, 350f, 110f, 10f, 100f, 20)
+        };
+
+        // Act
+        var metrics = WhisperPerformanceMetrics.Combine(windows, 60f);
+
+        // Assert
+        Assert.Equal(120.0f, metrics.TimeToFirstToken, 0.001f);
+        Assert.Equal(200.0f, metrics.FeatureExtractionAndEncodeTime, 0.001f);
+        Assert.Equal(700.0f, metrics.DecodeTime, 0.001f);
+        Assert.Equal(15.0f, metrics.TimePerOutputToken, 0.001f);
+    }
+
     [Theory]
     [InlineData("")]
     [InlineData(null)]